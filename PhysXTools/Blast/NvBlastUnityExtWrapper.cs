@@ -109,6 +109,12 @@ public struct BlastConfiguration
     public float        radialVariability;
 };
 
+public enum VoronoiNeighborSearch
+{
+    HalfspaceTest = 0,  //tests every pair of sites, may report extra neighbors
+    SecurityRadius = 1  //clips each cell with nearest sites only, much faster for many sites
+};
+
 public static class NvBlastUnityExtTypes
 {
     public static CutoutConfiguration GetDefaultCutoutConf()
@@ -260,6 +266,37 @@ public class NvMeshCleaner : DisposablePtr
     }
 }
 
+public class NvPointInMeshClassifier : DisposablePtr
+{
+    public const string DLL_NAME = "NvBlastUnityExt" + NvBlastWrapper.DLL_POSTFIX + NvBlastWrapper.DLL_PLATFORM;
+
+    [DllImport(DLL_NAME)]
+    private static extern IntPtr NvBlastUnityExtPointClassifierCreate(IntPtr mesh);
+
+    [DllImport(DLL_NAME)]
+    private static extern void NvBlastUnityExtPointClassifierRelease(IntPtr classifier);
+
+    [DllImport(DLL_NAME)]
+    private static extern void NvBlastUnityExtPointClassifierClassify(IntPtr classifier, [In] Vector3[] points, int count, [In, Out] int[] results);
+
+    //mesh can be disposed after classifier is created
+    public NvPointInMeshClassifier(NvMesh mesh)
+    {
+        Initialize(NvBlastUnityExtPointClassifierCreate(mesh.ptr));
+    }
+
+    //results[i] != 0 if points[i] is inside the mesh
+    public void classify(Vector3[] points, int[] results)
+    {
+        NvBlastUnityExtPointClassifierClassify(this.ptr, points, Math.Min(points.Length, results.Length), results);
+    }
+
+    protected override void Release()
+    {
+        NvBlastUnityExtPointClassifierRelease(this.ptr);
+    }
+}
+
 public class NvVoronoiSitesGenerator : DisposablePtr
 {
     public const string DLL_NAME = "NvBlastUnityExt" + NvBlastWrapper.DLL_POSTFIX + NvBlastWrapper.DLL_PLATFORM;
@@ -310,6 +347,12 @@ public class NvVoronoiSitesGenerator : DisposablePtr
     [DllImport(DLL_NAME)]
     private static extern int NvBlastUnityExtVSGGetNeighbors(IntPtr vsg, [In, Out] Vector2[] arr, int bufferSize);
 
+    [DllImport(DLL_NAME)]
+    private static extern void NvBlastUnityExtVSGSetNeighborSearch(IntPtr vsg, int method);
+
+    [DllImport(DLL_NAME)]
+    private static extern int NvBlastUnityExtVSGGetNeighborsCSR(IntPtr vsg, out IntPtr offsets, out IntPtr neighbors, out uint sitesCount);
+
 
     public NvVoronoiSitesGenerator(NvMesh mesh)
     {
@@ -376,6 +419,25 @@ public class NvVoronoiSitesGenerator : DisposablePtr
     {
         return NvBlastUnityExtVSGGetNeighbors(this.ptr, buffer, bufferSize);
     }
+    public void setNeighborSearch(VoronoiNeighborSearch method)
+    {
+        NvBlastUnityExtVSGSetNeighborSearch(this.ptr, (int)method);
+    }
+    //Neighbors of site i are neighbors[offsets[i]] .. neighbors[offsets[i + 1] - 1], returns number of neighbor pairs
+    public int getNeighborsCSR(out int[] offsets, out int[] neighbors)
+    {
+        IntPtr offsetsPtr, neighborsPtr;
+        uint sitesCount;
+        int neighborCount = NvBlastUnityExtVSGGetNeighborsCSR(this.ptr, out offsetsPtr, out neighborsPtr, out sitesCount);
+        offsets = new int[sitesCount + 1];
+        neighbors = new int[neighborCount * 2];
+        Marshal.Copy(offsetsPtr, offsets, 0, offsets.Length);
+        if (neighbors.Length > 0)
+        {
+            Marshal.Copy(neighborsPtr, neighbors, 0, neighbors.Length);
+        }
+        return neighborCount;
+    }
 
 
 
@@ -462,6 +524,9 @@ public class NvFractureTool : DisposablePtr
     [DllImport(DLL_NAME)]
     private static extern int NvBlastUnityExtFractureToolGetChunkCount(IntPtr tool);
 
+    [DllImport(DLL_NAME)]
+    private static extern void NvBlastUnityExtFractureToolCompactChunks(IntPtr tool);
+
     [DllImport(DLL_NAME)]
     private static extern IntPtr NvBlastUnityExtFractureToolGetChunkMesh(IntPtr tool, int chunkId, bool inside);
 
@@ -520,6 +585,27 @@ public class NvFractureTool : DisposablePtr
     [DllImport(DLL_NAME)]
     private static extern void NvBlastUnityExtFractureToolGetCrackEdges(IntPtr tool, [In, Out] NvVertex[] CrackEdgeVertices);
 
+    [DllImport(DLL_NAME)]
+    private static extern void NvBlastUnityExtFractureToolSetThreadCount(IntPtr tool, uint threadCount);
+
+    [DllImport(DLL_NAME)]
+    private static extern void NvBlastUnityExtFractureToolSetNeighborSearch(IntPtr tool, int method);
+
+    [DllImport(DLL_NAME)]
+    private static extern int NvBlastUnityExtFractureToolVoronoiFracturingBatch(IntPtr tool, [In] uint[] chunkIds, [In] uint[] cellCounts, [In] Vector3[] cellPoints, int chunkCount, bool replaceChunk);
+
+    [DllImport(DLL_NAME)]
+    private static extern int NvBlastUnityExtFractureToolVoronoiFracturingBatchUniform(IntPtr tool, [In] uint[] chunkIds, int chunkCount, int sitesPerChunk, bool replaceChunk);
+
+    [DllImport(DLL_NAME)]
+    private static extern uint NvBlastUnityExtFractureToolSnapshot(IntPtr tool);
+
+    [DllImport(DLL_NAME)]
+    private static extern bool NvBlastUnityExtFractureToolRestore(IntPtr tool, uint snapshotId);
+
+    [DllImport(DLL_NAME)]
+    private static extern void NvBlastUnityExtFractureToolReleaseSnapshot(IntPtr tool, uint snapshotId);
+
 
     public NvFractureTool()
     {
@@ -551,11 +637,19 @@ public class NvFractureTool : DisposablePtr
         NvBlastUnityExtFractureToolFinalizeFracturing(this.ptr);
     }
 
+    //Number of chunk slots. Slots stay in place until finalizeFracturing or compactChunks, getChunkId returns -1 for
+    //slots of removed chunks, skip them until then
     public int getChunkCount()
     {
         return NvBlastUnityExtFractureToolGetChunkCount(this.ptr);
     }
 
+    //Drop slots of removed chunks, chunk info indices change, chunk ids don't
+    public void compactChunks()
+    {
+        NvBlastUnityExtFractureToolCompactChunks(this.ptr);
+    }
+
     public NvMesh getChunkMesh(int chunkId, bool inside)
     {
         return new NvMesh(NvBlastUnityExtFractureToolGetChunkMesh(this.ptr, chunkId, inside));
@@ -633,6 +727,46 @@ public class NvFractureTool : DisposablePtr
         NvBlastUnityExtFractureToolGetCrackEdges(this.ptr, vertices);
     }
 
+    //0 - one thread per core, 1 - fracture on the calling thread
+    public void setThreadCount(int threadCount)
+    {
+        NvBlastUnityExtFractureToolSetThreadCount(this.ptr, (uint)Math.Max(threadCount, 0));
+    }
+
+    public void setNeighborSearch(VoronoiNeighborSearch method)
+    {
+        NvBlastUnityExtFractureToolSetNeighborSearch(this.ptr, (int)method);
+    }
+
+    //Fracture several chunks at once, cellPoints holds sites of all chunks one after another, cellCounts[i] sites per chunk
+    public int voronoiFracturingBatch(uint[] chunkIds, uint[] cellCounts, Vector3[] cellPoints, bool replaceChunk)
+    {
+        return NvBlastUnityExtFractureToolVoronoiFracturingBatch(this.ptr, chunkIds, cellCounts, cellPoints, chunkIds.Length, replaceChunk);
+    }
+
+    //Fracture several chunks at once, sites are generated uniformly inside each chunk
+    public int voronoiFracturingBatch(uint[] chunkIds, int sitesPerChunk, bool replaceChunk)
+    {
+        return NvBlastUnityExtFractureToolVoronoiFracturingBatchUniform(this.ptr, chunkIds, chunkIds.Length, sitesPerChunk, replaceChunk);
+    }
+
+    //Save the fracture state, returns snapshot id. Meshes are shared with the tool until either side changes them
+    public uint snapshot()
+    {
+        return NvBlastUnityExtFractureToolSnapshot(this.ptr);
+    }
+
+    //Go back to the state saved by snapshot, the snapshot stays valid. Returns false for unknown snapshot id
+    public bool restore(uint snapshotId)
+    {
+        return NvBlastUnityExtFractureToolRestore(this.ptr, snapshotId);
+    }
+
+    public void releaseSnapshot(uint snapshotId)
+    {
+        NvBlastUnityExtFractureToolReleaseSnapshot(this.ptr, snapshotId);
+    }
+
 
     protected override void Release()
     {
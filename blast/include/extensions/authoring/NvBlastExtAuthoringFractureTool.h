@@ -253,6 +253,19 @@ struct BlastConfiguration
     float radialVariability;
 };
 
+/**
+    # UNITY EXTENSION FUNCTIONS
+    Algorithm used to find neighbor cells of voronoi sites
+*/
+struct VoronoiNeighborSearch
+{
+    enum Enum
+    {
+        HALFSPACE_TEST      = 0,    // Tests every pair of sites with VSA, O(n^2) tests. Conservative, may report extra neighbors
+        SECURITY_RADIUS     = 1     // Clips each cell with nearest sites only until security radius is reached, near linear
+    };
+};
+
 
 
 /**
@@ -345,6 +358,19 @@ class VoronoiSitesGenerator
 
     */
     virtual void blastPattern(const BlastConfiguration conf) = 0;
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Set algorithm used to find neighbors of generated sites
+        \param[in] method Neighbor search algorithm, VoronoiNeighborSearch::HALFSPACE_TEST by default
+    */
+    virtual void setNeighborSearch(VoronoiNeighborSearch::Enum method) = 0;
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Get algorithm used to find neighbors of generated sites
+    */
+    virtual VoronoiNeighborSearch::Enum getNeighborSearch() const = 0;
 };
 
 /**
@@ -481,10 +507,16 @@ class FractureTool
     virtual void finalizeFracturing() = 0;
 
     /**
-        Returns overall number of chunks in fracture.
+        Returns overall number of chunk slots in fracture. Chunk indices stay valid until compactChunks() or
+        finalizeFracturing(), slots of chunks removed meanwhile have chunk ID -1 and no mesh.
     */
     virtual uint32_t getChunkCount() const = 0;
 
+    /**
+        Drop slots of removed chunks. Chunk indices change, chunk IDs don't. Called by finalizeFracturing().
+    */
+    virtual void compactChunks() = 0;
+
     /**
         Get chunk information
     */
@@ -545,6 +577,14 @@ class FractureTool
     */
     virtual uint32_t getChunksIdAtDepth(uint32_t depth, int32_t*& chunkIds) const = 0;
 
+    /**
+        Iterate chunk IDs with given depth without allocation.
+        \param[in]      depth   Chunk depth
+        \param[in,out]  cursor  Iteration state, set to 0 before the first call
+        \return Next chunk ID at depth, -1 if there are no more chunks.
+    */
+    virtual int32_t getNextChunkIdAtDepth(uint32_t depth, uint32_t& cursor) const = 0;
+
     /**
         Get result geometry without noise as vertex and index buffers, where index buffers contain series of triplets
         which represent triangles.
@@ -636,6 +676,35 @@ class FractureTool
 
     */
     virtual void getCracks(void* data) = 0;
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Set number of worker threads used for fracturing. Results do not depend on the thread count.
+        \param[in] threadCount Number of threads, 0 - one per hardware core, 1 - run on calling thread only (default)
+    */
+    virtual void setThreadCount(uint32_t threadCount) = 0;
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Set algorithm used to find voronoi cell neighbors in voronoiFracturing.
+        \param[in] method Neighbor search algorithm, VoronoiNeighborSearch::HALFSPACE_TEST by default
+    */
+    virtual void setNeighborSearch(VoronoiNeighborSearch::Enum method) = 0;
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Fractures several chunks with voronoi method, each chunk with its own sites. Chunks are processed concurrently,
+        new chunks are committed in the order of chunkIds, so results don't depend on thread count.
+        Chunks with invalid input (unknown or repeated id, less than 2 sites, chunk 0 with replaceChunk) are skipped.
+        \param[in] chunkCount           Number of chunks to fracture
+        \param[in] chunkIds             Chunks to fracture
+        \param[in] cellCounts           Number of sites of each chunk
+        \param[in] cellPoints           Sites of all chunks, sites of chunk i follow sites of chunk i - 1
+        \param[in] replaceChunk         if 'true', newly generated chunks will replace source chunks
+        \return   If 0, all chunks were fractured successfully, 1 if some chunks were skipped.
+    */
+    virtual int32_t voronoiFracturingBatch(uint32_t chunkCount, const uint32_t* chunkIds, const uint32_t* cellCounts,
+                                           const NvcVec3* cellPoints, bool replaceChunk) = 0;
 };
 
 }  // namespace Blast
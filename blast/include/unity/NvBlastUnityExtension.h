@@ -38,6 +38,7 @@ class PatternGenerator;
 class SpatialGrid;
 class SpatialAccelerator;
 class BooleanTool;
+class PointInMeshClassifier;
 }  // namespace Blast
 }  // namespace Nv
 
@@ -80,6 +81,17 @@ NV_C_API void NvBlastUnityExtMeshCleanerRelease(Nv::Blast::MeshCleaner* cleaner)
 NV_C_API Nv::Blast::Mesh* NvBlastUnityExtMeshCleanerCleanMesh(Nv::Blast::MeshCleaner* cleaner, Nv::Blast::Mesh* mesh);
 
 
+/*
+    Point In Mesh Classifier Functions
+*/
+
+NV_C_API Nv::Blast::PointInMeshClassifier* NvBlastUnityExtPointClassifierCreate(Nv::Blast::Mesh* mesh);
+
+NV_C_API void NvBlastUnityExtPointClassifierRelease(Nv::Blast::PointInMeshClassifier* classifier);
+
+NV_C_API void NvBlastUnityExtPointClassifierClassify(Nv::Blast::PointInMeshClassifier* classifier, NvcVec3* points, int count, void* results);
+
+
 /*
     VoronoiSitesGenerator Functions
 */
@@ -128,6 +140,10 @@ NV_C_API void NvBlastUnityExtVSGBlastPattern(Nv::Blast::VoronoiSitesGenerator* v
 
 NV_C_API int32_t NvBlastUnityExtVSGGetNeighbors(Nv::Blast::VoronoiSitesGenerator* vsg, void* data, int bufferSize);
 
+NV_C_API void NvBlastUnityExtVSGSetNeighborSearch(Nv::Blast::VoronoiSitesGenerator* vsg, int method);
+
+NV_C_API int32_t NvBlastUnityExtVSGGetNeighborsCSR(Nv::Blast::VoronoiSitesGenerator* vsg, const int32_t** offsets, const int32_t** neighbors, uint32_t* sitesCount);
+
 
 /*
     Fracture Tool Functions
@@ -152,6 +168,8 @@ NV_C_API void NvBlastUnityExtFractureToolFinalizeFracturing(Nv::Blast::FractureT
 
 NV_C_API uint32_t NvBlastUnityExtFractureToolGetChunkCount(Nv::Blast::FractureTool* tool);
 
+NV_C_API void NvBlastUnityExtFractureToolCompactChunks(Nv::Blast::FractureTool* tool);
+
 NV_C_API Nv::Blast::Mesh* NvBlastUnityExtFractureToolGetChunkMesh(Nv::Blast::FractureTool* tool, int chunkId, bool inside);
 
 NV_C_API bool NvBlastUnityExtFractureToolSetSourceMeshes(Nv::Blast::FractureTool* tool,
@@ -180,6 +198,8 @@ NV_C_API int32_t NvBlastUnityExtFractureToolGetChunkId(Nv::Blast::FractureTool*
 
 NV_C_API int32_t NvBlastUnityExtFractureToolGetChunkDepth(Nv::Blast::FractureTool* tool, int chunkId);
 
+NV_C_API int32_t NvBlastUnityExtFractureToolGetNextChunkIdAtDepth(Nv::Blast::FractureTool* tool, uint32_t depth, uint32_t* cursor);
+
 NV_C_API int32_t NvBlastUnityExtFractureToolIslandDetectionAndRemoving(Nv::Blast::FractureTool* tool, int chunkId);
 
 NV_C_API bool NvBlastUnityExtFractureToolIsMeshContainOpenEdges(Nv::Blast::FractureTool* tool, Nv::Blast::Mesh* mesh);
@@ -201,6 +221,29 @@ NV_C_API int NvBlastUnityExtFractureToolGetCrackEdgesCount(Nv::Blast::FractureTo
 
 NV_C_API void NvBlastUnityExtFractureToolGetCrackEdges(Nv::Blast::FractureTool* tool, void* data);
 
+NV_C_API void NvBlastUnityExtFractureToolSetThreadCount(Nv::Blast::FractureTool* tool, uint32_t threadCount);
+
+NV_C_API void NvBlastUnityExtFractureToolSetNeighborSearch(Nv::Blast::FractureTool* tool, int method);
+
+NV_C_API int32_t NvBlastUnityExtFractureToolVoronoiFracturingBatch(Nv::Blast::FractureTool* tool,
+                                                                   const uint32_t* chunkIds,
+                                                                   const uint32_t* cellCounts,
+                                                                   const NvcVec3* cellPoints,
+                                                                   int chunkCount,
+                                                                   bool replaceChunk);
+
+NV_C_API int32_t NvBlastUnityExtFractureToolVoronoiFracturingBatchUniform(Nv::Blast::FractureTool* tool,
+                                                                          const uint32_t* chunkIds,
+                                                                          int chunkCount,
+                                                                          int sitesPerChunk,
+                                                                          bool replaceChunk);
+
+NV_C_API uint32_t NvBlastUnityExtFractureToolSnapshot(Nv::Blast::FractureTool* tool);
+
+NV_C_API bool NvBlastUnityExtFractureToolRestore(Nv::Blast::FractureTool* tool, uint32_t snapshotId);
+
+NV_C_API void NvBlastUnityExtFractureToolReleaseSnapshot(Nv::Blast::FractureTool* tool, uint32_t snapshotId);
+
 
 
 
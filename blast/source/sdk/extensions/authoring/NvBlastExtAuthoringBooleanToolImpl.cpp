@@ -30,9 +30,11 @@
 #include "NvBlastExtAuthoringBooleanTool.h"
 #include "NvBlastExtAuthoringMeshImpl.h"
 #include "NvBlastExtAuthoringAcceleratorImpl.h"
+#include "NvBlastExtAuthoringBvhAccelerator.h"
 #include <NvBlastNvSharedHelpers.h>
 
 #include <math.h>
+#include <string.h>
 #include <set>
 #include <algorithm>
 
@@ -58,14 +60,219 @@ NV_FORCE_INLINE void vec2Lerp(const NvcVec2& a, const NvcVec2& b, NvcVec2& out,
     out.y = (b.y - a.y) * t + a.y;
 }
 
+void EdgeFacetIntersectionList::reset(uint32_t facetCount)
+{
+    mFacetCount = facetCount;
+    mPendingFacets.clear();
+    mPending.clear();
+    mOffsets.assign(facetCount + 1, 0);
+    mData.clear();
+}
+
+void EdgeFacetIntersectionList::finalize()
+{
+    for (uint32_t facet : mPendingFacets)
+    {
+        mOffsets[facet + 1]++;
+    }
+    for (uint32_t f = 0; f < mFacetCount; ++f)
+    {
+        mOffsets[f + 1] += mOffsets[f];
+    }
+    mData.resize(mPending.size());
+    for (uint32_t i = 0; i < mPending.size(); ++i)
+    {
+        // mOffsets[facet] is used as insertion cursor and ends up at the start of next facet
+        mData[mOffsets[mPendingFacets[i]]++] = mPending[i];
+    }
+    for (uint32_t f = mFacetCount; f > 0; --f)
+    {
+        mOffsets[f] = mOffsets[f - 1];
+    }
+    mOffsets[0] = 0;
+    mPendingFacets.clear();
+    mPending.clear();
+}
+
+size_t EdgeFacetIntersectionList::getCapacityBytes() const
+{
+    return (mPendingFacets.capacity() + mOffsets.capacity()) * sizeof(uint32_t) +
+           (mPending.capacity() + mData.capacity()) * sizeof(EdgeFacetIntersectionData);
+}
+
+/**
+    Vertex welding hash, see BooleanEvaluator::addIfNotExist
+*/
+NV_FORCE_INLINE uint32_t hashMix(uint32_t h, uint32_t value)
+{
+    h ^= value + 0x9e3779b9u + (h << 6) + (h >> 2);
+    return h;
+}
+
+NV_FORCE_INLINE uint32_t hashFinalize(uint32_t h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+NV_FORCE_INLINE uint32_t floatBits(float value)
+{
+    // -0 and +0 compare equal, so they must hash equal
+    if (value == 0.0f)
+    {
+        value = 0.0f;
+    }
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+NV_FORCE_INLINE uint32_t hashVertex(const Vertex& v)
+{
+    uint32_t h = floatBits(v.p.x);
+    h = hashMix(h, floatBits(v.p.y));
+    h = hashMix(h, floatBits(v.p.z));
+    h = hashMix(h, floatBits(v.n.x));
+    h = hashMix(h, floatBits(v.n.y));
+    h = hashMix(h, floatBits(v.n.z));
+    h = hashMix(h, floatBits(v.uv[0].x));
+    h = hashMix(h, floatBits(v.uv[0].y));
+    return hashFinalize(h);
+}
+
+NV_FORCE_INLINE uint32_t hashCell(int32_t x, int32_t y, int32_t z)
+{
+    return hashFinalize(hashMix(hashMix(static_cast<uint32_t>(x), static_cast<uint32_t>(y)), static_cast<uint32_t>(z)));
+}
+
+NV_FORCE_INLINE bool isSameVertex(const Vertex& a, const Vertex& b)
+{
+    return a.p.x == b.p.x && a.p.y == b.p.y && a.p.z == b.p.z && a.n.x == b.n.x && a.n.y == b.n.y && a.n.z == b.n.z &&
+           a.uv[0].x == b.uv[0].x && a.uv[0].y == b.uv[0].y;
+}
+
+NV_FORCE_INLINE bool isNearVertex(const Vertex& a, const Vertex& b, float tolerance)
+{
+    return std::abs(a.p.x - b.p.x) <= tolerance && std::abs(a.p.y - b.p.y) <= tolerance && std::abs(a.p.z - b.p.z) <= tolerance &&
+           std::abs(a.n.x - b.n.x) <= tolerance && std::abs(a.n.y - b.n.y) <= tolerance && std::abs(a.n.z - b.n.z) <= tolerance &&
+           std::abs(a.uv[0].x - b.uv[0].x) <= tolerance && std::abs(a.uv[0].y - b.uv[0].y) <= tolerance;
+}
+
+NV_FORCE_INLINE void BooleanEvaluator::getWeldCell(const Vertex& p, int32_t cell[3]) const
+{
+    // Clamped so that conversion to int is defined for any coordinate
+    const float limit = 1e9f;
+    cell[0] = static_cast<int32_t>(nvidia::NvClamp(floorf(p.p.x / mWeldTolerance), -limit, limit));
+    cell[1] = static_cast<int32_t>(nvidia::NvClamp(floorf(p.p.y / mWeldTolerance), -limit, limit));
+    cell[2] = static_cast<int32_t>(nvidia::NvClamp(floorf(p.p.z / mWeldTolerance), -limit, limit));
+}
+
+NV_FORCE_INLINE uint32_t BooleanEvaluator::getWeldHash(const Vertex& p) const
+{
+    if (mWeldTolerance > 0.0f)
+    {
+        int32_t cell[3];
+        getWeldCell(p, cell);
+        return hashCell(cell[0], cell[1], cell[2]);
+    }
+    return hashVertex(p);
+}
+
+void BooleanEvaluator::insertWeldVertex(int32_t index)
+{
+    const uint32_t mask = static_cast<uint32_t>(mWeldTable.size()) - 1;
+    uint32_t slot = getWeldHash(mVerticesAggregate[index]) & mask;
+    while (mWeldTable[slot] != -1)
+    {
+        slot = (slot + 1) & mask;
+    }
+    mWeldTable[slot] = index;
+}
+
+int32_t BooleanEvaluator::findWeldVertex(const Vertex& p) const
+{
+    if (mWeldTable.empty())
+    {
+        return -1;
+    }
+    const uint32_t mask = static_cast<uint32_t>(mWeldTable.size()) - 1;
+    if (mWeldTolerance <= 0.0f)
+    {
+        for (uint32_t slot = hashVertex(p) & mask; mWeldTable[slot] != -1; slot = (slot + 1) & mask)
+        {
+            if (isSameVertex(mVerticesAggregate[mWeldTable[slot]], p))
+            {
+                return mWeldTable[slot];
+            }
+        }
+        return -1;
+    }
+
+    /**
+        Vertices within tolerance lie in the same or adjacent cells, cell size is equal to tolerance.
+        The first inserted one wins, so result doesn't depend on table layout.
+    */
+    int32_t cell[3];
+    getWeldCell(p, cell);
+    int32_t result = -1;
+    for (int32_t dx = -1; dx <= 1; ++dx)
+    {
+        for (int32_t dy = -1; dy <= 1; ++dy)
+        {
+            for (int32_t dz = -1; dz <= 1; ++dz)
+            {
+                for (uint32_t slot = hashCell(cell[0] + dx, cell[1] + dy, cell[2] + dz) & mask; mWeldTable[slot] != -1; slot = (slot + 1) & mask)
+                {
+                    const int32_t candidate = mWeldTable[slot];
+                    if ((result == -1 || candidate < result) && isNearVertex(mVerticesAggregate[candidate], p, mWeldTolerance))
+                    {
+                        result = candidate;
+                    }
+                }
+            }
+        }
+    }
+    return result;
+}
+
 NV_FORCE_INLINE int32_t BooleanEvaluator::addIfNotExist(const Vertex& p)
 {
+    const int32_t existing = findWeldVertex(p);
+    if (existing != -1)
+    {
+        return existing;
+    }
+
+    const int32_t index = static_cast<int32_t>(mVerticesAggregate.size());
     mVerticesAggregate.push_back(p);
-    return static_cast<int32_t>(mVerticesAggregate.size()) - 1;
+
+    // Keep load factor at most 1/2, table size is power of 2
+    if (mWeldTable.size() < 2 * mVerticesAggregate.size())
+    {
+        mWeldTable.assign(std::max<size_t>(256, mWeldTable.size() * 2), -1);
+        for (int32_t i = 0; i <= index; ++i)
+        {
+            insertWeldVertex(i);
+        }
+    }
+    else
+    {
+        insertWeldVertex(index);
+    }
+    return index;
 }
 
 NV_FORCE_INLINE void BooleanEvaluator::addEdgeIfValid(const EdgeWithParent& ed)
 {
+    // Edge between welded vertices has zero length
+    if (ed.s == ed.e)
+    {
+        return;
+    }
     mEdgeAggregate.push_back(ed);
 }
 
@@ -716,13 +923,59 @@ int32_t BooleanEvaluator::isPointContainedInMesh(const Mesh* msh, SpatialAcceler
 
 
 
+void BooleanEvaluator::buildEdgeBounds()
+{
+    mEdgeBoundsA.build(mMeshA);
+    mEdgeBoundsB.build(mMeshB);
+    /**
+        Interpolated Y coordinates can differ from exact ones by a few ulps, margin is much larger than that
+    */
+    mCullingMargin = 1e-5f * (mEdgeBoundsA.getMaxAbsY() + mEdgeBoundsB.getMaxAbsY() + 1.0f);
+    mEdgeOverlapA.resize(mMeshA->getEdgesCount());
+}
+
+void BooleanEvaluator::markCandidateOverlaps(uint32_t facetB)
+{
+    /**
+        Tests are batched over all candidate facets, so SIMD packs are filled even for triangles: edges of candidates
+        are tested against bounds of facet B in one call over the edge range spanning them, bounds of candidates are
+        tested against each edge of facet B in one call over the facet range spanning them.
+    */
+    uint32_t firstFacet = UINT32_MAX, endFacet = 0, firstEdge = UINT32_MAX, endEdge = 0;
+    for (int32_t facetA : mCandidateFacetsA)
+    {
+        const Facet* facet = mMeshA->getFacet(facetA);
+        firstFacet         = std::min(firstFacet, static_cast<uint32_t>(facetA));
+        endFacet           = std::max(endFacet, static_cast<uint32_t>(facetA) + 1);
+        firstEdge          = std::min(firstEdge, facet->firstEdgeNumber);
+        endEdge            = std::max(endEdge, facet->firstEdgeNumber + facet->edgesCount);
+    }
+    if (firstEdge < endEdge)
+    {
+        mEdgeBoundsA.markOverlappingEdges(firstEdge, endEdge - firstEdge,
+                                          mEdgeBoundsB.getFacetBounds(facetB, mCullingMargin),
+                                          mEdgeOverlapA.data() + firstEdge);
+    }
+
+    const Facet* facet    = mMeshB->getFacet(facetB);
+    mCandidateFirstFacetA = firstFacet;
+    mCandidateFacetSpanA  = endFacet - firstFacet;
+    mFacetOverlapB.resize(facet->edgesCount * mCandidateFacetSpanA);
+    for (uint32_t i = 0; i < facet->edgesCount; ++i)
+    {
+        mEdgeBoundsA.markOverlappingFacets(firstFacet, mCandidateFacetSpanA,
+                                           mEdgeBoundsB.getEdgeBounds(facet->firstEdgeNumber + i, mCullingMargin),
+                                           mFacetOverlapB.data() + i * mCandidateFacetSpanA);
+    }
+}
+
 void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
 {
     int32_t statusValue = 0;
     int32_t inclusionValue = 0;
 
-    std::vector<std::pair<Vertex, Vertex> > retainedStarts;
-    std::vector<std::pair<Vertex, Vertex>> retainedEnds;
+    std::vector<std::pair<Vertex, Vertex>>& retainedStarts = mRetainedStartPairs;
+    std::vector<std::pair<Vertex, Vertex>>& retainedEnds   = mRetainedEndPairs;
     VertexPairComparator comp;
 
     Vertex newPointA;
@@ -730,18 +983,25 @@ void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
 
     const Vertex* meshAPoints = mMeshA->getVertices();
     const Vertex* meshBPoints = mMeshB->getVertices();
-    EdgeWithParent newEdge;
-    mEdgeFacetIntersectionData12.clear();
-    mEdgeFacetIntersectionData21.clear();
-    
-    mEdgeFacetIntersectionData12.resize(mMeshA->getFacetCount());
-    mEdgeFacetIntersectionData21.resize(mMeshB->getFacetCount());
+    mEdgeFacetIntersectionData12.reset(mMeshA->getFacetCount());
+    mEdgeFacetIntersectionData21.reset(mMeshB->getFacetCount());
+    buildEdgeBounds();
 
     for (uint32_t facetB = 0; facetB < mMeshB->getFacetCount(); ++facetB)
     {
         mAcceleratorA->setState(meshBPoints, mMeshB->getEdges(), *mMeshB->getFacet(facetB));
-        int32_t facetA = mAcceleratorA->getNextFacet();
-        while (facetA != -1)
+        mCandidateFacetsA.clear();
+        for (int32_t facetA = mAcceleratorA->getNextFacet(); facetA != -1; facetA = mAcceleratorA->getNextFacet())
+        {
+            mCandidateFacetsA.push_back(facetA);
+        }
+        if (mCandidateFacetsA.empty())
+        {
+            continue;
+        }
+        markCandidateOverlaps(facetB);
+
+        for (int32_t facetA : mCandidateFacetsA)
         {
             const Edge* facetBEdges = mMeshB->getEdges() + mMeshB->getFacet(facetB)->firstEdgeNumber;
             const Edge* facetAEdges = mMeshA->getEdges() + mMeshA->getFacet(facetA)->firstEdgeNumber;
@@ -753,9 +1013,33 @@ void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
             NvcVec3 compositeStartPoint = {0, 0, 0};
             uint32_t facetAEdgeCount = mMeshA->getFacet(facetA)->edgesCount;
             uint32_t facetBEdgeCount = mMeshB->getFacet(facetB)->edgesCount;
+
+            /**
+                Edges which don't overlap the other facet in XY get zero status, skip them
+            */
+            const uint8_t* overlapA = mEdgeOverlapA.data() + mMeshA->getFacet(facetA)->firstEdgeNumber;
+            const uint8_t* overlapB = mFacetOverlapB.data() + (facetA - mCandidateFirstFacetA);
+            uint32_t overlapCount   = 0;
+            for (uint32_t i = 0; i < facetAEdgeCount; ++i)
+            {
+                overlapCount += overlapA[i];
+            }
+            for (uint32_t i = 0; i < facetBEdgeCount; ++i)
+            {
+                overlapCount += overlapB[i * mCandidateFacetSpanA];
+            }
+            if (overlapCount == 0)
+            {
+                continue;
+            }
             int32_t ic = 0;
             for (uint32_t i = 0; i < facetAEdgeCount; ++i)
             {
+                if (overlapA[i] == 0)
+                {
+                    fae++;
+                    continue;
+                }
                 if (shouldSwap(meshAPoints[fae->e].p, meshAPoints[fae->s].p))
                 {
                     statusValue = -edgeFacetIntersection12(meshAPoints[fae->e], meshAPoints[fae->s], meshBPoints, facetBEdges, facetBEdgeCount, newPointA, newPointB);
@@ -772,7 +1056,7 @@ void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
                         retainedEnds.push_back(std::make_pair(newPointA, newPointB));
                         compositeEndPoint = compositeEndPoint + newPointA.p;
                     }
-                    mEdgeFacetIntersectionData12[facetA].push_back(EdgeFacetIntersectionData(i, statusValue, newPointA));
+                    mEdgeFacetIntersectionData12.add(facetA, EdgeFacetIntersectionData(i, statusValue, newPointA));
                 }
                 if (inclusionValue < 0)
                 {
@@ -781,12 +1065,17 @@ void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
                         retainedStarts.push_back(std::make_pair(newPointA, newPointB));
                         compositeStartPoint = compositeStartPoint + newPointA.p;
                     }
-                    mEdgeFacetIntersectionData12[facetA].push_back(EdgeFacetIntersectionData(i, statusValue, newPointA));
+                    mEdgeFacetIntersectionData12.add(facetA, EdgeFacetIntersectionData(i, statusValue, newPointA));
                 }
                 fae++;
             }
             for (uint32_t i = 0; i < facetBEdgeCount; ++i)
             {
+                if (overlapB[i * mCandidateFacetSpanA] == 0)
+                {
+                    fbe++;
+                    continue;
+                }
                 if (shouldSwap(meshBPoints[fbe->e].p, meshBPoints[fbe->s].p))
                 {
                     statusValue = -edgeFacetIntersection21(meshBPoints[fbe->e], meshBPoints[fbe->s], meshAPoints, facetAEdges, facetAEdgeCount, newPointA, newPointB);
@@ -804,7 +1093,7 @@ void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
                         retainedEnds.push_back(std::make_pair(newPointA, newPointB));
                         compositeEndPoint = compositeEndPoint + newPointB.p;
                     }
-                    mEdgeFacetIntersectionData21[facetB].push_back(EdgeFacetIntersectionData( i, statusValue, newPointB));
+                    mEdgeFacetIntersectionData21.add(facetB, EdgeFacetIntersectionData(i, statusValue, newPointB));
                 }
                 if (inclusionValue < 0)
                 {
@@ -813,7 +1102,7 @@ void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
                         retainedStarts.push_back(std::make_pair(newPointA, newPointB));
                         compositeStartPoint = compositeStartPoint + newPointB.p;
                     }
-                    mEdgeFacetIntersectionData21[facetB].push_back(EdgeFacetIntersectionData(i, statusValue, newPointB));
+                    mEdgeFacetIntersectionData21.add(facetB, EdgeFacetIntersectionData(i, statusValue, newPointB));
                 }
                 fbe++;
             }
@@ -823,22 +1112,14 @@ void BooleanEvaluator::buildFaceFaceIntersections(const BooleanConf& mode)
                 return;
             }
             for (uint32_t rv = 0; rv < retainedStarts.size(); ++rv)
-            {               
-                newEdge.s = addIfNotExist(retainedStarts[rv].first);
-                newEdge.e = addIfNotExist(retainedEnds[rv].first);
-                newEdge.parent = facetA;
-                addEdgeIfValid(newEdge);
-                newEdge.parent = facetB + mMeshA->getFacetCount();
-                newEdge.e = addIfNotExist(retainedStarts[rv].second);
-                newEdge.s = addIfNotExist(retainedEnds[rv].second);
-                addEdgeIfValid(newEdge);
+            {
+                mRetainedSegments.push_back({ static_cast<uint32_t>(facetA), facetB, retainedStarts[rv], retainedEnds[rv] });
 
                 /* Unity Extensions */
                 mCrackEdges.push_back(std::make_pair(retainedStarts[rv].first, retainedEnds[rv].first));
                 //mCrackEdges.push_back(std::make_pair(retainedStarts[rv].second, retainedEnds[rv].second));
             }
-            facetA = mAcceleratorA->getNextFacet();
-        } // while (*iter != -1)
+        } // for (int32_t facetA : mCandidateFacetsA)
     } // for (uint32_t facetB = 0; facetB < mMeshB->getFacetCount(); ++facetB)
 }
 
@@ -848,21 +1129,23 @@ void BooleanEvaluator::buildFastFaceFaceIntersection(const BooleanConf& mode)
     int32_t statusValue = 0;
     int32_t inclusionValue = 0;
 
-    std::vector<std::pair<Vertex, Vertex> > retainedStarts;
-    std::vector<std::pair<Vertex, Vertex>> retainedEnds;
+    std::vector<std::pair<Vertex, Vertex>>& retainedStarts = mRetainedStartPairs;
+    std::vector<std::pair<Vertex, Vertex>>& retainedEnds   = mRetainedEndPairs;
     VertexPairComparator comp;
 
     Vertex newPointA;
     Vertex newPointB;
     const Vertex* meshAPoints = mMeshA->getVertices();
     const Vertex* meshBPoints = mMeshB->getVertices();
-    EdgeWithParent newEdge;
-
-    mEdgeFacetIntersectionData12.clear();
-    mEdgeFacetIntersectionData21.clear();
 
-    mEdgeFacetIntersectionData12.resize(mMeshA->getFacetCount());
-    mEdgeFacetIntersectionData21.resize(mMeshB->getFacetCount());
+    mEdgeFacetIntersectionData12.reset(mMeshA->getFacetCount());
+    mEdgeFacetIntersectionData21.reset(mMeshB->getFacetCount());
+    buildEdgeBounds();
+    /**
+        All facets of A are tested against facet 0 of the cutting box, edges of all of them are culled in one call
+    */
+    mEdgeBoundsA.markOverlappingEdges(0, mMeshA->getEdgesCount(), mEdgeBoundsB.getFacetBounds(0, mCullingMargin),
+                                      mEdgeOverlapA.data());
 
     for (uint32_t facetA = 0; facetA < mMeshA->getFacetCount(); ++facetA)
     {
@@ -876,9 +1159,19 @@ void BooleanEvaluator::buildFastFaceFaceIntersection(const BooleanConf& mode)
         NvcVec3 compositeStartPoint = {0, 0, 0};
         uint32_t facetAEdgeCount = mMeshA->getFacet(facetA)->edgesCount;
         uint32_t facetBEdgeCount = mMeshB->getFacet(facetB)->edgesCount;
+        const uint8_t* overlapA = mEdgeOverlapA.data() + mMeshA->getFacet(facetA)->firstEdgeNumber;
+        if (std::find(overlapA, overlapA + facetAEdgeCount, 1) == overlapA + facetAEdgeCount)
+        {
+            continue;
+        }
         int32_t ic = 0;
         for (uint32_t i = 0; i < facetAEdgeCount; ++i)
         {
+            if (overlapA[i] == 0)
+            {
+                fae++;
+                continue;
+            }
             if (shouldSwap(meshAPoints[fae->e].p, meshAPoints[fae->s].p))
             {
                 statusValue = -edgeFacetIntersection12(meshAPoints[fae->e], meshAPoints[fae->s], meshBPoints, facetBEdges, facetBEdgeCount, newPointA, newPointB);
@@ -896,7 +1189,7 @@ void BooleanEvaluator::buildFastFaceFaceIntersection(const BooleanConf& mode)
                     retainedEnds.push_back(std::make_pair(newPointA, newPointB));
                     compositeEndPoint = compositeEndPoint + newPointA.p;
                 }
-                mEdgeFacetIntersectionData12[facetA].push_back(EdgeFacetIntersectionData(i, statusValue, newPointA));
+                mEdgeFacetIntersectionData12.add(facetA, EdgeFacetIntersectionData(i, statusValue, newPointA));
             }
             if (inclusionValue < 0)
             {
@@ -905,7 +1198,7 @@ void BooleanEvaluator::buildFastFaceFaceIntersection(const BooleanConf& mode)
                     retainedStarts.push_back(std::make_pair(newPointA, newPointB));
                     compositeStartPoint = compositeStartPoint + newPointA.p;
                 }
-                mEdgeFacetIntersectionData12[facetA].push_back(EdgeFacetIntersectionData(i, statusValue, newPointA));
+                mEdgeFacetIntersectionData12.add(facetA, EdgeFacetIntersectionData(i, statusValue, newPointA));
             }
             fae++;
         }
@@ -922,14 +1215,7 @@ void BooleanEvaluator::buildFastFaceFaceIntersection(const BooleanConf& mode)
         }
         for (uint32_t rv = 0; rv < retainedStarts.size(); ++rv)
         {
-            newEdge.s = addIfNotExist(retainedStarts[rv].first);
-            newEdge.e = addIfNotExist(retainedEnds[rv].first);
-            newEdge.parent = facetA;
-            addEdgeIfValid(newEdge);
-            newEdge.parent = facetB + mMeshA->getFacetCount();
-            newEdge.e = addIfNotExist(retainedStarts[rv].second);
-            newEdge.s = addIfNotExist(retainedEnds[rv].second);
-            addEdgeIfValid(newEdge);
+            mRetainedSegments.push_back({ facetA, static_cast<uint32_t>(facetB), retainedStarts[rv], retainedEnds[rv] });
         }
     }
 }
@@ -941,17 +1227,16 @@ void BooleanEvaluator::collectRetainedPartsFromA(const BooleanConf& mode)
     int32_t inclusionValue = 0;
     const Vertex* vertices = mMeshA->getVertices();
     VertexComparator comp;
-    const NvBounds3& bMeshBoudning = toNvShared(mMeshB->getBoundingBox());
     const Edge* facetEdges = mMeshA->getEdges();
-    std::vector<Vertex> retainedStartVertices;
-    std::vector<Vertex> retainedEndVertices;
-    retainedStartVertices.reserve(255);
-    retainedEndVertices.reserve(255);
+    std::vector<Vertex>& retainedStartVertices = mRetainedStartVertices;
+    std::vector<Vertex>& retainedEndVertices   = mRetainedEndVertices;
     int32_t ic = 0;
     for (uint32_t facetId = 0; facetId < mMeshA->getFacetCount(); ++facetId)
     {
         retainedStartVertices.clear();
         retainedEndVertices.clear();
+        const EdgeFacetIntersectionData* facetIntersections = mEdgeFacetIntersectionData12.get(facetId);
+        const uint32_t facetIntersectionCount               = mEdgeFacetIntersectionData12.getCount(facetId);
         for (uint32_t i = 0; i < mMeshA->getFacet(facetId)->edgesCount; ++i)
         {
             NvcVec3 compositeEndPoint = {0, 0, 0};
@@ -959,14 +1244,7 @@ void BooleanEvaluator::collectRetainedPartsFromA(const BooleanConf& mode)
 
             int32_t lastPos = static_cast<int32_t>(retainedEndVertices.size());
             /* Test start and end point of edge against mesh */
-            if (bMeshBoudning.contains(toNvShared(vertices[facetEdges->s].p)))
-            {
-                statusValue = vertexMeshStatus03(vertices[facetEdges->s].p, mMeshB);
-            }
-            else
-            {
-                statusValue = 0;
-            }
+            statusValue = getVertexStatusA(facetEdges->s);
 
             inclusionValue = -inclusionValue03(mode, statusValue);
             if (inclusionValue > 0)
@@ -986,14 +1264,7 @@ void BooleanEvaluator::collectRetainedPartsFromA(const BooleanConf& mode)
                 }
             }
 
-            if (bMeshBoudning.contains(toNvShared(vertices[facetEdges->e].p)))
-            {
-                statusValue = vertexMeshStatus03(vertices[facetEdges->e].p, mMeshB);
-            }
-            else
-            {
-                statusValue = 0;
-            }
+            statusValue = getVertexStatusA(facetEdges->e);
 
             inclusionValue = inclusionValue03(mode, statusValue);
             if (inclusionValue > 0)
@@ -1014,9 +1285,9 @@ void BooleanEvaluator::collectRetainedPartsFromA(const BooleanConf& mode)
             }
 
             /* Test edge intersection with mesh*/
-            for (uint32_t intrs = 0; intrs < mEdgeFacetIntersectionData12[facetId].size(); ++intrs)
+            for (uint32_t intrs = 0; intrs < facetIntersectionCount; ++intrs)
             {
-                const EdgeFacetIntersectionData& intr = mEdgeFacetIntersectionData12[facetId][intrs];
+                const EdgeFacetIntersectionData& intr = facetIntersections[intrs];
                 if (intr.edId != (int32_t)i)
                     continue;
 
@@ -1072,37 +1343,29 @@ void BooleanEvaluator::collectRetainedPartsFromB(const BooleanConf& mode)
     int32_t inclusionValue = 0;
     const Vertex* vertices = mMeshB->getVertices();
     VertexComparator comp;
-    const NvBounds3& aMeshBoudning = toNvShared(mMeshA->getBoundingBox());
     const Edge* facetEdges = mMeshB->getEdges();
-    std::vector<Vertex> retainedStartVertices;
-    std::vector<Vertex> retainedEndVertices;
-    retainedStartVertices.reserve(255);
-    retainedEndVertices.reserve(255);
+    std::vector<Vertex>& retainedStartVertices = mRetainedStartVertices;
+    std::vector<Vertex>& retainedEndVertices   = mRetainedEndVertices;
     int32_t ic = 0;
     for (uint32_t facetId = 0; facetId < mMeshB->getFacetCount(); ++facetId)
     {
         retainedStartVertices.clear();
         retainedEndVertices.clear();
+        const EdgeFacetIntersectionData* facetIntersections = mEdgeFacetIntersectionData21.get(facetId);
+        const uint32_t facetIntersectionCount               = mEdgeFacetIntersectionData21.getCount(facetId);
         for (uint32_t i = 0; i < mMeshB->getFacet(facetId)->edgesCount; ++i)
         {
             NvcVec3 compositeEndPoint = {0, 0, 0};
             NvcVec3 compositeStartPoint = {0, 0, 0};
             int32_t lastPos = static_cast<int32_t>(retainedEndVertices.size());
-            if (aMeshBoudning.contains(toNvShared(vertices[facetEdges->s].p)))
-            {
-                statusValue = vertexMeshStatus30(vertices[facetEdges->s].p, mMeshA);
-            }
-            else
-            {
-                statusValue = 0;
-            }
-            
+            statusValue = getVertexStatusB(facetEdges->s);
+
             inclusionValue = -inclusionValue30(mode, statusValue);
             if (inclusionValue > 0)
             {
                 for (ic = 0; ic < inclusionValue; ++ic)
                 {
-                    retainedEndVertices.push_back(vertices[facetEdges->s]);
+                    retainedEndVertices.push_back(getOutputVertexB(vertices[facetEdges->s]));
                     compositeEndPoint = compositeEndPoint + vertices[facetEdges->s].p;
                 }
 
@@ -1111,26 +1374,19 @@ void BooleanEvaluator::collectRetainedPartsFromB(const BooleanConf& mode)
             {
                 for (ic = 0; ic < -inclusionValue; ++ic)
                 {
-                    retainedStartVertices.push_back(vertices[facetEdges->s]);
+                    retainedStartVertices.push_back(getOutputVertexB(vertices[facetEdges->s]));
                     compositeStartPoint = compositeStartPoint + vertices[facetEdges->s].p;
                 }
             }
 
-            if (aMeshBoudning.contains(toNvShared(vertices[facetEdges->e].p)))
-            {
-                statusValue = vertexMeshStatus30(vertices[facetEdges->e].p, mMeshA);
-            }
-            else
-            {
-                statusValue = 0;
-            }
+            statusValue = getVertexStatusB(facetEdges->e);
 
             inclusionValue = inclusionValue30(mode, statusValue);
             if (inclusionValue > 0)
             {
                 for (ic = 0; ic < inclusionValue; ++ic)
                 {
-                    retainedEndVertices.push_back(vertices[facetEdges->e]);
+                    retainedEndVertices.push_back(getOutputVertexB(vertices[facetEdges->e]));
                     compositeEndPoint = compositeEndPoint + vertices[facetEdges->e].p;
                 }
 
@@ -1139,15 +1395,15 @@ void BooleanEvaluator::collectRetainedPartsFromB(const BooleanConf& mode)
             {
                 for (ic = 0; ic < -inclusionValue; ++ic)
                 {
-                    retainedStartVertices.push_back(vertices[facetEdges->e]);
+                    retainedStartVertices.push_back(getOutputVertexB(vertices[facetEdges->e]));
                     compositeStartPoint = compositeStartPoint + vertices[facetEdges->e].p;
                 }
 
             }
 
-            for (uint32_t intrs = 0; intrs < mEdgeFacetIntersectionData21[facetId].size(); ++intrs)
+            for (uint32_t intrs = 0; intrs < facetIntersectionCount; ++intrs)
             {
-                const EdgeFacetIntersectionData& intr = mEdgeFacetIntersectionData21[facetId][intrs];
+                const EdgeFacetIntersectionData& intr = facetIntersections[intrs];
                 if (intr.edId != (int32_t)i)
                     continue;
 
@@ -1156,7 +1412,7 @@ void BooleanEvaluator::collectRetainedPartsFromB(const BooleanConf& mode)
                 {
                     for (ic = 0; ic < inclusionValue; ++ic)
                     {
-                        retainedEndVertices.push_back(intr.intersectionPoint);
+                        retainedEndVertices.push_back(getOutputVertexB(intr.intersectionPoint));
                         compositeEndPoint = compositeEndPoint + intr.intersectionPoint.p;
                     }
                 }
@@ -1164,7 +1420,7 @@ void BooleanEvaluator::collectRetainedPartsFromB(const BooleanConf& mode)
                 {
                     for (ic = 0; ic < -inclusionValue; ++ic)
                     {
-                        retainedStartVertices.push_back(intr.intersectionPoint);
+                        retainedStartVertices.push_back(getOutputVertexB(intr.intersectionPoint));
                         compositeStartPoint = compositeStartPoint + intr.intersectionPoint.p;
                     }
                 }
@@ -1195,24 +1451,72 @@ void BooleanEvaluator::collectRetainedPartsFromB(const BooleanConf& mode)
     return;
 }
 
-bool EdgeWithParentSortComp(const EdgeWithParent& a, const EdgeWithParent& b)
+/**
+    Opposite of BOOLEAN_INTERSECTION or BOOLEAN_DIFFERENCE
+*/
+NV_FORCE_INLINE BooleanConf getComplementConf(const BooleanConf& mode)
 {
-    return a.parent < b.parent;
+    return BooleanConf(1 - mode.ca, mode.cb, -mode.ci);
 }
 
-
-void BooleanEvaluator::performBoolean(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB, const BooleanConf& mode)
+void BooleanEvaluator::beginOperation(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB)
 {
     reset();
     mMeshA = meshA;
     mMeshB = meshB;
     mAcceleratorA = spAccelA;
     mAcceleratorB = spAccelB;
-    buildFaceFaceIntersections(mode);
+    mVertexStatusA.assign(mMeshA->getVerticesCount(), INT32_MIN);
+    mVertexStatusB.assign(mMeshB->getVerticesCount(), INT32_MIN);
+}
+
+void BooleanEvaluator::collectOutput(const BooleanConf& mode, bool fastCutting)
+{
+    emitRetainedSegments();
     collectRetainedPartsFromA(mode);
-    collectRetainedPartsFromB(mode);
+    if (!fastCutting)
+    {
+        collectRetainedPartsFromB(mode);
+    }
+}
+
+void BooleanEvaluator::beginComplementOutput()
+{
+    mEdgeAggregate.clear();
+    mVerticesAggregate.clear();
+    mWeldTable.clear();
+    mComplementOutput = true;
+}
+
+void BooleanEvaluator::endOperation()
+{
     mAcceleratorA = nullptr;
     mAcceleratorB = nullptr;
+    updateStats();
+}
+
+SpatialAccelerator* BooleanEvaluator::getDefaultAccelerator(const Mesh* mesh, BvhAccelerator& bvh, DummyAccelerator& dummy)
+{
+    /**
+        Same choice as createDefaultAccelerator(...), without allocating: DummyAccelerator lives on the caller's stack,
+        BVH is rebuilt in buffers kept from previous operations
+    */
+    if (mesh->getFacetCount() < kBvhAcceleratorMinFacetCount)
+    {
+        return &dummy;
+    }
+    bvh.rebuild(mesh);
+    return &bvh;
+}
+
+void BooleanEvaluator::performBoolean(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB, const BooleanConf& mode)
+{
+    beginOperation(meshA, meshB, spAccelA, spAccelB);
+    buildFaceFaceIntersections(mode);
+    mEdgeFacetIntersectionData12.finalize();
+    mEdgeFacetIntersectionData21.finalize();
+    collectOutput(mode, false);
+    endOperation();
 }
 
 void BooleanEvaluator::performBoolean(const Mesh* meshA, const Mesh* meshB, const BooleanConf& mode)
@@ -1222,21 +1526,19 @@ void BooleanEvaluator::performBoolean(const Mesh* meshA, const Mesh* meshB, cons
     mMeshB = meshB;
     DummyAccelerator ac = DummyAccelerator(mMeshA->getFacetCount());
     DummyAccelerator bc = DummyAccelerator(mMeshB->getFacetCount());
-    performBoolean(meshA, meshB, &ac, &bc, mode);
+    performBoolean(meshA, meshB, getDefaultAccelerator(meshA, mDefaultBvhA, ac), getDefaultAccelerator(meshB, mDefaultBvhB, bc),
+                   mode);
 }
 
 
 void BooleanEvaluator::performFastCutting(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB, const BooleanConf& mode)
 {
-    reset();
-    mMeshA = meshA;
-    mMeshB = meshB;
-    mAcceleratorA = spAccelA;
-    mAcceleratorB = spAccelB;
+    beginOperation(meshA, meshB, spAccelA, spAccelB);
     buildFastFaceFaceIntersection(mode);
-    collectRetainedPartsFromA(mode);
-    mAcceleratorA = nullptr;
-    mAcceleratorB = nullptr;
+    mEdgeFacetIntersectionData12.finalize();
+    mEdgeFacetIntersectionData21.finalize();
+    collectOutput(mode, true);
+    endOperation();
 }
 
 void BooleanEvaluator::performFastCutting(const Mesh* meshA, const Mesh* meshB, const BooleanConf& mode)
@@ -1246,7 +1548,110 @@ void BooleanEvaluator::performFastCutting(const Mesh* meshA, const Mesh* meshB,
     mMeshB = meshB;
     DummyAccelerator ac = DummyAccelerator(mMeshA->getFacetCount());
     DummyAccelerator bc = DummyAccelerator(mMeshB->getFacetCount());
-    performFastCutting(meshA, meshB, &ac, &bc, mode);
+    performFastCutting(meshA, meshB, getDefaultAccelerator(meshA, mDefaultBvhA, ac),
+                       getDefaultAccelerator(meshB, mDefaultBvhB, bc), mode);
+}
+
+void BooleanEvaluator::performBooleanSplit(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB,
+                                           const BooleanConf& mode, Mesh*& result, Mesh*& complement)
+{
+    beginOperation(meshA, meshB, spAccelA, spAccelB);
+    buildFaceFaceIntersections(mode);
+    mEdgeFacetIntersectionData12.finalize();
+    mEdgeFacetIntersectionData21.finalize();
+    collectOutput(mode, false);
+    result = createNewMesh();
+    beginComplementOutput();
+    collectOutput(getComplementConf(mode), false);
+    complement = createNewMesh();
+    endOperation();
+}
+
+void BooleanEvaluator::performBooleanSplit(const Mesh* meshA, const Mesh* meshB, const BooleanConf& mode, Mesh*& result, Mesh*& complement)
+{
+    DummyAccelerator ac = DummyAccelerator(meshA->getFacetCount());
+    DummyAccelerator bc = DummyAccelerator(meshB->getFacetCount());
+    performBooleanSplit(meshA, meshB, getDefaultAccelerator(meshA, mDefaultBvhA, ac), getDefaultAccelerator(meshB, mDefaultBvhB, bc),
+                       mode, result, complement);
+}
+
+void BooleanEvaluator::performFastCuttingSplit(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB,
+                                               const BooleanConf& mode, Mesh*& result, Mesh*& complement)
+{
+    beginOperation(meshA, meshB, spAccelA, spAccelB);
+    buildFastFaceFaceIntersection(mode);
+    mEdgeFacetIntersectionData12.finalize();
+    mEdgeFacetIntersectionData21.finalize();
+    collectOutput(mode, true);
+    result = createNewMesh();
+    beginComplementOutput();
+    collectOutput(getComplementConf(mode), true);
+    complement = createNewMesh();
+    endOperation();
+}
+
+void BooleanEvaluator::performFastCuttingSplit(const Mesh* meshA, const Mesh* meshB, const BooleanConf& mode, Mesh*& result, Mesh*& complement)
+{
+    DummyAccelerator ac = DummyAccelerator(meshA->getFacetCount());
+    DummyAccelerator bc = DummyAccelerator(meshB->getFacetCount());
+    performFastCuttingSplit(meshA, meshB, getDefaultAccelerator(meshA, mDefaultBvhA, ac), getDefaultAccelerator(meshB, mDefaultBvhB, bc),
+                           mode, result, complement);
+}
+
+void BooleanEvaluator::emitRetainedSegments()
+{
+    const uint32_t facetCountA = mMeshA->getFacetCount();
+    EdgeWithParent newEdge;
+    for (const RetainedSegment& segment : mRetainedSegments)
+    {
+        /**
+            Retained parts of opposite mode are the same segments with opposite direction
+        */
+        const std::pair<Vertex, Vertex>& start = mComplementOutput ? segment.end : segment.start;
+        const std::pair<Vertex, Vertex>& end   = mComplementOutput ? segment.start : segment.end;
+        newEdge.s      = addIfNotExist(start.first);
+        newEdge.e      = addIfNotExist(end.first);
+        newEdge.parent = segment.facetA;
+        addEdgeIfValid(newEdge);
+        newEdge.parent = segment.facetB + facetCountA;
+        newEdge.e      = addIfNotExist(getOutputVertexB(start.second));
+        newEdge.s      = addIfNotExist(getOutputVertexB(end.second));
+        addEdgeIfValid(newEdge);
+    }
+}
+
+NV_FORCE_INLINE Vertex BooleanEvaluator::getOutputVertexB(const Vertex& p) const
+{
+    Vertex result = p;
+    if (mComplementOutput)
+    {
+        result.n.x = -result.n.x;
+        result.n.y = -result.n.y;
+        result.n.z = -result.n.z;
+    }
+    return result;
+}
+
+int32_t BooleanEvaluator::getVertexStatusA(uint32_t vertex)
+{
+    int32_t& status = mVertexStatusA[vertex];
+    if (status == INT32_MIN)
+    {
+        const NvcVec3& p = mMeshA->getVertices()[vertex].p;
+        status = toNvShared(mMeshB->getBoundingBox()).contains(toNvShared(p)) ? vertexMeshStatus03(p, mMeshB) : 0;
+    }
+    return status;
+}
+
+int32_t BooleanEvaluator::getVertexStatusB(uint32_t vertex)
+{
+    int32_t& status = mVertexStatusB[vertex];
+    if (status == INT32_MIN)
+    {
+        const NvcVec3& p = mMeshB->getVertices()[vertex].p;
+        status = toNvShared(mMeshA->getBoundingBox()).contains(toNvShared(p)) ? vertexMeshStatus30(p, mMeshA) : 0;
+    }
+    return status;
 }
 
 
@@ -1258,6 +1663,60 @@ BooleanEvaluator::BooleanEvaluator()
     mMeshB = nullptr;
     mAcceleratorA = nullptr;
     mAcceleratorB = nullptr;
+    mCullingMargin = 0.0f;
+    mWeldTolerance = 0.0f;
+    mComplementOutput = false;
+    resetStats();
+}
+
+void BooleanEvaluator::resetStats()
+{
+    mStats.operationCount  = 0;
+    mStats.allocationCount = 0;
+    mStats.scratchBytes    = 0;
+    mScratchCapacity.clear();
+}
+
+void BooleanEvaluator::updateStats()
+{
+    const size_t capacities[] = {
+        mEdgeAggregate.capacity() * sizeof(EdgeWithParent),
+        mVerticesAggregate.capacity() * sizeof(Vertex),
+        mWeldTable.capacity() * sizeof(int32_t),
+        mEdgeFacetIntersectionData12.getCapacityBytes(),
+        mEdgeFacetIntersectionData21.getCapacityBytes(),
+        mEdgeBoundsA.getCapacityBytes(),
+        mEdgeBoundsB.getCapacityBytes(),
+        mCandidateFacetsA.capacity() * sizeof(int32_t),
+        mEdgeOverlapA.capacity() + mFacetOverlapB.capacity(),
+        (mRetainedStartPairs.capacity() + mRetainedEndPairs.capacity()) * sizeof(std::pair<Vertex, Vertex>),
+        (mRetainedStartVertices.capacity() + mRetainedEndVertices.capacity()) * sizeof(Vertex),
+        mNewEdges.capacity() * sizeof(Edge),
+        mNewFacets.capacity() * sizeof(Facet),
+        mRetainedSegments.capacity() * sizeof(RetainedSegment),
+        (mVertexStatusA.capacity() + mVertexStatusB.capacity()) * sizeof(int32_t),
+        mParentOffsets.capacity() * sizeof(uint32_t),
+        mCrackEdges.capacity() * sizeof(std::pair<Vertex, Vertex>)
+    };
+    const uint32_t count = sizeof(capacities) / sizeof(capacities[0]);
+    mScratchCapacity.resize(count, 0);
+    mStats.operationCount++;
+    mStats.scratchBytes = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (capacities[i] > mScratchCapacity[i])
+        {
+            mStats.allocationCount++;
+            mScratchCapacity[i] = capacities[i];
+        }
+        mStats.scratchBytes += capacities[i];
+    }
+}
+
+void BooleanEvaluator::setWeldTolerance(float tolerance)
+{
+    mWeldTolerance = std::max(tolerance, 0.0f);
+    mWeldTable.clear();
 }
 BooleanEvaluator::~BooleanEvaluator()
 {
@@ -1272,56 +1731,44 @@ Mesh* BooleanEvaluator::createNewMesh()
     {
         return nullptr;
     }
-    std::sort(mEdgeAggregate.begin(), mEdgeAggregate.end(), EdgeWithParentSortComp);
-    std::vector<Facet> newFacets;
-    std::vector<Edge>  newEdges(mEdgeAggregate.size());
-    int32_t lastPos = 0;
-    uint32_t lastParent = mEdgeAggregate[0].parent;
-    uint32_t collected = 0;
-    int64_t userData = 0;
-    int32_t materialId = 0;
-    int32_t smoothingGroup = 0;
-
-    for (uint32_t i = 0; i < mEdgeAggregate.size(); ++i)
+    /**
+        Parents are dense indices of facets of A followed by facets of B, so edges are grouped by parent with
+        counting sort. Edges of a facet keep the order in which they were collected.
+    */
+    const uint32_t facetCountA = mMeshA->getFacetCount();
+    const uint32_t parentCount = facetCountA + (mMeshB != nullptr ? mMeshB->getFacetCount() : 0);
+    std::vector<uint32_t>& parentOffsets = mParentOffsets;
+    parentOffsets.assign(parentCount + 1, 0);
+    for (const EdgeWithParent& edge : mEdgeAggregate)
     {
-        if (mEdgeAggregate[i].parent != lastParent)
-        {           
-            if (lastParent < mMeshA->getFacetCount())
-            {
-                userData = mMeshA->getFacet(lastParent)->userData;
-                materialId = mMeshA->getFacet(lastParent)->materialId;
-                smoothingGroup = mMeshA->getFacet(lastParent)->smoothingGroup;
-            }
-            else
-            {
-                userData = mMeshB->getFacet(lastParent - mMeshA->getFacetCount())->userData;
-                materialId = mMeshB->getFacet(lastParent - mMeshA->getFacetCount())->materialId;
-                smoothingGroup = mMeshB->getFacet(lastParent - mMeshA->getFacetCount())->smoothingGroup;
-            }
-            newFacets.push_back({ lastPos, collected, userData, materialId, smoothingGroup });
-            lastPos = i;
-            lastParent = mEdgeAggregate[i].parent;
-            collected = 0;
-        }
-        collected++;
-        newEdges[i].s = mEdgeAggregate[i].s;
-        newEdges[i].e = mEdgeAggregate[i].e;
+        parentOffsets[edge.parent + 1]++;
     }
-    if (lastParent < mMeshA->getFacetCount())
+
+    std::vector<Facet>& newFacets = mNewFacets;
+    newFacets.clear();
+    for (uint32_t parent = 0; parent < parentCount; ++parent)
     {
-        userData = mMeshA->getFacet(lastParent)->userData;
-        materialId = mMeshA->getFacet(lastParent)->materialId;
-        smoothingGroup = mMeshA->getFacet(lastParent)->smoothingGroup;
+        const uint32_t collected = parentOffsets[parent + 1];
+        parentOffsets[parent + 1] += parentOffsets[parent];
+        if (collected == 0)
+        {
+            continue;
+        }
+        const Facet* parentFacet = parent < facetCountA ? mMeshA->getFacet(parent) : mMeshB->getFacet(parent - facetCountA);
+        const int64_t userData   = parent >= facetCountA && mComplementOutput ? -parentFacet->userData : parentFacet->userData;
+        newFacets.push_back({ static_cast<int32_t>(parentOffsets[parent]), collected, userData, parentFacet->materialId,
+                              parentFacet->smoothingGroup });
     }
-    else
+
+    std::vector<Edge>& newEdges = mNewEdges;
+    newEdges.resize(mEdgeAggregate.size());
+    for (const EdgeWithParent& edge : mEdgeAggregate)
     {
-        uint32_t pr = lastParent - mMeshA->getFacetCount();
-        userData = mMeshB->getFacet(pr)->userData;
-        materialId = mMeshB->getFacet(pr)->materialId;
-        smoothingGroup = mMeshB->getFacet(pr)->smoothingGroup;
+        Edge& newEdge = newEdges[parentOffsets[edge.parent]++];
+        newEdge.s     = edge.s;
+        newEdge.e     = edge.e;
     }
-    newFacets.push_back({ lastPos, collected, userData, materialId, smoothingGroup });
-    return new MeshImpl(mVerticesAggregate.data(), newEdges.data(), newFacets.data(), static_cast<uint32_t>(mVerticesAggregate.size()), static_cast<uint32_t>(mEdgeAggregate.size()), static_cast<uint32_t>(newFacets.size()));
+    return new MeshImpl(mVerticesAggregate.data(), newEdges.data(), newFacets.data(), static_cast<uint32_t>(mVerticesAggregate.size()), static_cast<uint32_t>(newEdges.size()), static_cast<uint32_t>(newFacets.size()));
 }
 
 void BooleanEvaluator::reset()
@@ -1332,8 +1779,11 @@ void BooleanEvaluator::reset()
     mAcceleratorB   = nullptr;
     mEdgeAggregate.clear();
     mVerticesAggregate.clear();
-    mEdgeFacetIntersectionData12.clear();
-    mEdgeFacetIntersectionData21.clear();
+    mWeldTable.clear();
+    mEdgeFacetIntersectionData12.reset(0);
+    mEdgeFacetIntersectionData21.reset(0);
+    mRetainedSegments.clear();
+    mComplementOutput = false;
 
     /* Unity Extensions */
     mCrackEdges.clear();
@@ -1378,10 +1828,19 @@ Mesh* BooleanToolImpl::performBoolean(const Mesh* meshA, SpatialAccelerator* acc
         return nullptr;
     }
 
-    DummyAccelerator dmAccelA(meshA->getFacetCount());
-    DummyAccelerator dmAccelB(meshA->getFacetCount());
+    SpatialAccelerator* defaultAccelA = accelA ? nullptr : createDefaultAccelerator(meshA);
+    SpatialAccelerator* defaultAccelB = accelB ? nullptr : createDefaultAccelerator(meshB);
+
+    m_evaluator.performBoolean(meshA, meshB, accelA ? accelA : defaultAccelA, accelB ? accelB : defaultAccelB, modes[op]);
 
-    m_evaluator.performBoolean(meshA, meshB, accelA ? accelA : &dmAccelA, accelB ? accelB : &dmAccelB, modes[op]);
+    if (defaultAccelA)
+    {
+        defaultAccelA->release();
+    }
+    if (defaultAccelB)
+    {
+        defaultAccelB->release();
+    }
 
     return m_evaluator.createNewMesh();
 }
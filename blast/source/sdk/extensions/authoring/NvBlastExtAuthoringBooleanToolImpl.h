@@ -31,6 +31,8 @@
 #include "NvBlastExtAuthoringTypes.h"
 #include "NvBlastExtAuthoringInternalCommon.h"
 #include "NvBlastExtAuthoringBooleanTool.h"
+#include "NvBlastExtAuthoringEdgeCulling.h"
+#include "NvBlastExtAuthoringBvhAccelerator.h"
 #include <vector>
 #include "NvBlastTypes.h"
 
@@ -92,12 +94,63 @@ struct EdgeFacetIntersectionData
     {   }
     EdgeFacetIntersectionData(int32_t edId) : edId(edId)
     {   }
+    EdgeFacetIntersectionData() : edId(-1), intersectionType(0)
+    {   }
     bool operator<(const EdgeFacetIntersectionData& b) const
     {
         return edId < b.edId;
     }
 };
 
+/**
+    Edge-facet intersections of all mesh facets in CSR layout. Intersections are appended in arbitrary facet order
+    and grouped by facet with stable counting sort in finalize(), so order of intersections of a facet is preserved.
+    Buffers keep their capacity between operations.
+*/
+class EdgeFacetIntersectionList
+{
+public:
+    /**
+        Remove all intersections.
+        \param[in] facetCount  Number of mesh facets
+    */
+    void        reset(uint32_t facetCount);
+
+    void        add(uint32_t facet, const EdgeFacetIntersectionData& data)
+    {
+        mPendingFacets.push_back(facet);
+        mPending.push_back(data);
+    }
+
+    /**
+        Group added intersections by facet, should be called before getCount(...) and get(...).
+    */
+    void        finalize();
+
+    uint32_t    getCount(uint32_t facet) const { return mOffsets[facet + 1] - mOffsets[facet]; }
+    const EdgeFacetIntersectionData* get(uint32_t facet) const { return mData.data() + mOffsets[facet]; }
+
+    size_t      getCapacityBytes() const;
+
+private:
+    uint32_t                                mFacetCount = 0;
+    std::vector<uint32_t>                   mPendingFacets;
+    std::vector<EdgeFacetIntersectionData>  mPending;
+    std::vector<uint32_t>                   mOffsets;
+    std::vector<EdgeFacetIntersectionData>  mData;
+};
+
+/**
+    Scratch memory statistics of BooleanEvaluator. Scratch buffers keep their capacity between operations, so once
+    evaluator has processed the largest meshes allocationCount stops growing.
+*/
+struct BooleanEvaluatorStats
+{
+    uint32_t    operationCount;     // Number of performed boolean and cutting operations
+    uint32_t    allocationCount;    // Number of scratch buffer reallocations, each buffer is counted once per operation
+    size_t      scratchBytes;       // Memory reserved by scratch buffers
+};
+
 
 class SpatialAccelerator;
 
@@ -123,7 +176,8 @@ public:
     void    performBoolean(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB, const BooleanConf& mode);
 
     /**
-        Perform boolean operation on two polygonal meshes (A and B).
+        Perform boolean operation on two polygonal meshes (A and B). Accelerators are picked as createDefaultAccelerator(...)
+        does, BVH accelerators are evaluator members rebuilt in place, so repeated calls don't allocate them.
         \param[in] meshA    Mesh A
         \param[in] meshB    Mesh B
         \param[in] mode     Boolean operation type
@@ -144,12 +198,55 @@ public:
     /**
         Perform cutting of mesh with some large box, which represents cutting plane. This method skips part of intersetion computations, so
         should be used ONLY with cutting box, received from getBigBox(...) method from NvBlastExtAuthoringMesh.h. For cutting use only BOOLEAN_INTERSECTION or BOOLEAN_DIFFERENCE mode.
+        Accelerators are picked the same way as for performBoolean(meshA, meshB, mode).
         \param[in] meshA    Mesh A
         \param[in] meshB    Cutting box
         \param[in] mode     Boolean operation type
     */
     void    performFastCutting(const Mesh* meshA, const Mesh* meshB, const BooleanConf& mode);
 
+    /**
+        Split mesh A with mesh B into two parts, face-face intersections and vertex statuses are computed once for both parts.
+        Result is the same as performBoolean(...) with mode, complement is the same as performBoolean(...) with opposite mode
+        and mesh B with inverted normals and facet user data (see inverseNormalAndIndices(...) from NvBlastExtAuthoringMeshUtils.h).
+        After the call createNewMesh() returns complement again.
+        \param[in]  meshA       Mesh A
+        \param[in]  meshB       Mesh B
+        \param[in]  spAccelA    Acceleration structure for mesh A
+        \param[in]  spAccelB    Acceleration structure for mesh B
+        \param[in]  mode        BOOLEAN_INTERSECTION or BOOLEAN_DIFFERENCE
+        \param[out] result      Result geometry of mode, nullptr if empty
+        \param[out] complement  Result geometry of opposite mode, nullptr if empty
+    */
+    void    performBooleanSplit(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB,
+                                const BooleanConf& mode, Mesh*& result, Mesh*& complement);
+
+    /**
+        Split mesh A with mesh B into two parts, see performBooleanSplit(...). Accelerators are picked the same way as
+        for performBoolean(meshA, meshB, mode).
+    */
+    void    performBooleanSplit(const Mesh* meshA, const Mesh* meshB, const BooleanConf& mode, Mesh*& result, Mesh*& complement);
+
+    /**
+        Split mesh A with cutting box into two parts, face-face intersections and vertex statuses are computed once for both parts.
+        Same restrictions as for performFastCutting(...) apply, result and complement are the same as with performBooleanSplit(...).
+        \param[in]  meshA       Mesh A
+        \param[in]  meshB       Cutting box
+        \param[in]  spAccelA    Acceleration structure for mesh A
+        \param[in]  spAccelB    Acceleration structure for cutting box
+        \param[in]  mode        BOOLEAN_INTERSECTION or BOOLEAN_DIFFERENCE
+        \param[out] result      Result geometry of mode, nullptr if empty
+        \param[out] complement  Result geometry of opposite mode, nullptr if empty
+    */
+    void    performFastCuttingSplit(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB,
+                                    const BooleanConf& mode, Mesh*& result, Mesh*& complement);
+
+    /**
+        Split mesh A with cutting box into two parts, see performFastCuttingSplit(...). Accelerators are picked the same
+        way as for performBoolean(meshA, meshB, mode).
+    */
+    void    performFastCuttingSplit(const Mesh* meshA, const Mesh* meshB, const BooleanConf& mode, Mesh*& result, Mesh*& complement);
+
     /**
         Test whether point contained in mesh.
         \param[in] mesh     Mesh geometry
@@ -178,6 +275,20 @@ public:
     */
     void    reset();
 
+    /**
+        Set tolerance of vertex welding in result mesh. With 0 (default) only vertices with exactly equal position,
+        normal and UV are welded, otherwise vertices whose components all differ by at most tolerance are welded.
+        Should be set before performing boolean operation.
+    */
+    void    setWeldTolerance(float tolerance);
+
+    /**
+        Scratch memory statistics, accumulated since construction or last resetStats() call.
+    */
+    const BooleanEvaluatorStats& getStats() const { return mStats; }
+
+    void    resetStats();
+
     
     /**
         Unity Extensions
@@ -185,7 +296,28 @@ public:
     void    setCrackEdges(std::vector<std::pair<Vertex, Vertex>>& edges);
 
 private:
-
+    /**
+        Pair of retained intersection segments of facets A and B, first vertices have attributes of A, second of B
+    */
+    struct RetainedSegment
+    {
+        uint32_t                    facetA;
+        uint32_t                    facetB;
+        std::pair<Vertex, Vertex>   start;
+        std::pair<Vertex, Vertex>   end;
+    };
+
+    void    beginOperation(const Mesh* meshA, const Mesh* meshB, SpatialAccelerator* spAccelA, SpatialAccelerator* spAccelB);
+    void    collectOutput(const BooleanConf& mode, bool fastCutting);
+    void    beginComplementOutput();
+    void    endOperation();
+    void    emitRetainedSegments();
+    Vertex  getOutputVertexB(const Vertex& p) const;
+    int32_t getVertexStatusA(uint32_t vertex);
+    int32_t getVertexStatusB(uint32_t vertex);
+
+    void    buildEdgeBounds();
+    void    markCandidateOverlaps(uint32_t facetB);
     void    buildFaceFaceIntersections(const BooleanConf& mode);
     void    buildFastFaceFaceIntersection(const BooleanConf& mode);
     void    collectRetainedPartsFromA(const BooleanConf& mode);
@@ -193,6 +325,12 @@ private:
 
     int32_t addIfNotExist(const Vertex& p);
     void    addEdgeIfValid(const EdgeWithParent& ed);
+    void    getWeldCell(const Vertex& p, int32_t cell[3]) const;
+    uint32_t getWeldHash(const Vertex& p) const;
+    void    insertWeldVertex(int32_t index);
+    int32_t findWeldVertex(const Vertex& p) const;
+    void    updateStats();
+    SpatialAccelerator* getDefaultAccelerator(const Mesh* mesh, BvhAccelerator& bvh, DummyAccelerator& dummy);
 private:
 
     int32_t vertexMeshStatus03(const NvcVec3& p, const Mesh* mesh);
@@ -204,11 +342,51 @@ private:
     SpatialAccelerator*                                     mAcceleratorA;
     SpatialAccelerator*                                     mAcceleratorB;
 
+    /* Accelerators of overloads without accelerator arguments, see getDefaultAccelerator(...) */
+    BvhAccelerator                                          mDefaultBvhA;
+    BvhAccelerator                                          mDefaultBvhB;
+
     std::vector<EdgeWithParent>                             mEdgeAggregate;
     std::vector<Vertex>                                     mVerticesAggregate;
 
-    std::vector<std::vector<EdgeFacetIntersectionData> >    mEdgeFacetIntersectionData12;
-    std::vector<std::vector<EdgeFacetIntersectionData> >    mEdgeFacetIntersectionData21;
+    /* Open addressing table of mVerticesAggregate indices, -1 marks empty slot */
+    std::vector<int32_t>                                    mWeldTable;
+    float                                                   mWeldTolerance;
+
+    EdgeFacetIntersectionList                               mEdgeFacetIntersectionData12;
+    EdgeFacetIntersectionList                               mEdgeFacetIntersectionData21;
+
+    /* Retained intersection segments, emitted after face-face intersections are built */
+    std::vector<RetainedSegment>                            mRetainedSegments;
+
+    /* Cached vertex statuses against the other mesh, INT32_MIN if not computed yet */
+    std::vector<int32_t>                                    mVertexStatusA;
+    std::vector<int32_t>                                    mVertexStatusB;
+
+    /* Output is complement part of split, B normals and facet user data are inverted */
+    bool                                                    mComplementOutput;
+
+    /* Per facet scratch, kept between operations */
+    std::vector<std::pair<Vertex, Vertex>>                  mRetainedStartPairs;
+    std::vector<std::pair<Vertex, Vertex>>                  mRetainedEndPairs;
+    std::vector<Vertex>                                     mRetainedStartVertices;
+    std::vector<Vertex>                                     mRetainedEndVertices;
+    std::vector<Edge>                                       mNewEdges;
+    std::vector<Facet>                                      mNewFacets;
+    std::vector<uint32_t>                                   mParentOffsets;
+
+    BooleanEvaluatorStats                                   mStats;
+    std::vector<size_t>                                     mScratchCapacity;
+
+    /* Edge-facet culling, see EdgeBounds */
+    EdgeBounds                                              mEdgeBoundsA;
+    EdgeBounds                                              mEdgeBoundsB;
+    float                                                   mCullingMargin;
+    std::vector<int32_t>                                    mCandidateFacetsA;  // Accelerator result for current facet of B
+    uint32_t                                                mCandidateFirstFacetA;
+    uint32_t                                                mCandidateFacetSpanA;
+    std::vector<uint8_t>                                    mEdgeOverlapA;      // Edge of A overlaps current facet of B
+    std::vector<uint8_t>                                    mFacetOverlapB;     // [i * span + j]: edge i of current facet of B overlaps facet first + j of A
 
 
     /* Unity Extensions */
@@ -0,0 +1,346 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#include "NvBlastExtAuthoringBvhAccelerator.h"
+#include "NvBlastExtAuthoringMesh.h"
+#include <algorithm>
+#include <math.h>
+#include <float.h>
+
+namespace Nv
+{
+namespace Blast
+{
+
+namespace
+{
+const uint32_t kBvhLeafSize = 4;
+const uint32_t kBvhMaxLeafSize = 16;
+const float kBvhTraversalCost = 0.5f;
+const uint32_t kBvhBinCount = 12;
+const float kBvhRelativeMargin = 1e-5f;
+
+void setEmpty(float minimum[3], float maximum[3])
+{
+    for (uint32_t a = 0; a < 3; ++a)
+    {
+        minimum[a] = FLT_MAX;
+        maximum[a] = -FLT_MAX;
+    }
+}
+
+void include(float minimum[3], float maximum[3], const float bMinimum[3], const float bMaximum[3])
+{
+    for (uint32_t a = 0; a < 3; ++a)
+    {
+        minimum[a] = std::min(minimum[a], bMinimum[a]);
+        maximum[a] = std::max(maximum[a], bMaximum[a]);
+    }
+}
+
+float getHalfArea(const float minimum[3], const float maximum[3])
+{
+    const float dx = maximum[0] - minimum[0];
+    const float dy = maximum[1] - minimum[1];
+    const float dz = maximum[2] - minimum[2];
+    return (dx < 0.0f) ? 0.0f : dx * dy + dy * dz + dz * dx;
+}
+}  // namespace
+
+
+BvhAccelerator::BvhAccelerator() : mMaxAbsCoordinate(0.0f), mResultIndex(0)
+{
+}
+
+BvhAccelerator::BvhAccelerator(const Mesh* mesh) : mMaxAbsCoordinate(0.0f), mResultIndex(0)
+{
+    rebuild(mesh);
+}
+
+void BvhAccelerator::rebuild(const Mesh* mesh)
+{
+    mMaxAbsCoordinate = 0.0f;
+    mResult.clear();
+    mResultIndex = 0;
+    mNodes.clear();
+
+    const uint32_t facetCount = mesh->getFacetCount();
+    const Vertex* vertices    = mesh->getVertices();
+    const Edge* edges         = mesh->getEdges();
+    mFacetBounds.resize(facetCount);
+    mCentroids.resize(facetCount * 3);
+    mFacetOrder.resize(facetCount);
+    for (uint32_t f = 0; f < facetCount; ++f)
+    {
+        const Facet* facet = mesh->getFacet(f);
+        Box& box           = mFacetBounds[f];
+        setEmpty(box.minimum, box.maximum);
+        for (uint32_t e = facet->firstEdgeNumber; e < facet->firstEdgeNumber + facet->edgesCount; ++e)
+        {
+            const NvcVec3& p = vertices[edges[e].s].p;
+            const float c[3] = { p.x, p.y, p.z };
+            include(box.minimum, box.maximum, c, c);
+        }
+        for (uint32_t a = 0; a < 3; ++a)
+        {
+            mCentroids[f * 3 + a] = 0.5f * (box.minimum[a] + box.maximum[a]);
+            if (facet->edgesCount > 0)
+            {
+                mMaxAbsCoordinate = std::max(mMaxAbsCoordinate, std::max(fabsf(box.minimum[a]), fabsf(box.maximum[a])));
+            }
+        }
+        mFacetOrder[f] = f;
+    }
+
+    mNodes.reserve(facetCount > 0 ? 2 * facetCount : 1);
+    if (facetCount > 0)
+    {
+        build(0, facetCount);
+    }
+}
+
+uint32_t BvhAccelerator::build(uint32_t begin, uint32_t end)
+{
+    const uint32_t nodeIndex = static_cast<uint32_t>(mNodes.size());
+    mNodes.push_back(Node());
+
+    Box bounds, centroidBounds;
+    setEmpty(bounds.minimum, bounds.maximum);
+    setEmpty(centroidBounds.minimum, centroidBounds.maximum);
+    for (uint32_t i = begin; i < end; ++i)
+    {
+        const uint32_t f = mFacetOrder[i];
+        include(bounds.minimum, bounds.maximum, mFacetBounds[f].minimum, mFacetBounds[f].maximum);
+        include(centroidBounds.minimum, centroidBounds.maximum, &mCentroids[f * 3], &mCentroids[f * 3]);
+    }
+    mNodes[nodeIndex].bounds = bounds;
+    mNodes[nodeIndex].first  = begin;
+    mNodes[nodeIndex].count  = end - begin;
+
+    const uint32_t count = end - begin;
+    if (count <= kBvhLeafSize)
+    {
+        return nodeIndex;
+    }
+
+    /**
+        Binned SAH split along the axis of largest centroid extent
+    */
+    uint32_t axis = 0;
+    for (uint32_t a = 1; a < 3; ++a)
+    {
+        if (centroidBounds.maximum[a] - centroidBounds.minimum[a] > centroidBounds.maximum[axis] - centroidBounds.minimum[axis])
+        {
+            axis = a;
+        }
+    }
+    const float extent = centroidBounds.maximum[axis] - centroidBounds.minimum[axis];
+
+    uint32_t mid = begin + count / 2;
+    if (extent > 0.0f)
+    {
+        Box binBounds[kBvhBinCount];
+        uint32_t binCounts[kBvhBinCount] = { 0 };
+        for (uint32_t b = 0; b < kBvhBinCount; ++b)
+        {
+            setEmpty(binBounds[b].minimum, binBounds[b].maximum);
+        }
+        const float scale = kBvhBinCount / extent;
+        auto getBin = [&](uint32_t f)
+        {
+            const uint32_t b = static_cast<uint32_t>((mCentroids[f * 3 + axis] - centroidBounds.minimum[axis]) * scale);
+            return std::min(b, kBvhBinCount - 1);
+        };
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            const uint32_t f = mFacetOrder[i];
+            const uint32_t b = getBin(f);
+            binCounts[b]++;
+            include(binBounds[b].minimum, binBounds[b].maximum, mFacetBounds[f].minimum, mFacetBounds[f].maximum);
+        }
+
+        // Cost of splitting after bin b, sweeping from the right side first
+        float rightCost[kBvhBinCount];
+        Box sweep;
+        setEmpty(sweep.minimum, sweep.maximum);
+        uint32_t sweepCount = 0;
+        for (uint32_t b = kBvhBinCount - 1; b > 0; --b)
+        {
+            include(sweep.minimum, sweep.maximum, binBounds[b].minimum, binBounds[b].maximum);
+            sweepCount += binCounts[b];
+            rightCost[b - 1] = getHalfArea(sweep.minimum, sweep.maximum) * sweepCount;
+        }
+
+        float bestCost     = FLT_MAX;
+        uint32_t bestSplit = 0;
+        setEmpty(sweep.minimum, sweep.maximum);
+        sweepCount = 0;
+        for (uint32_t b = 0; b + 1 < kBvhBinCount; ++b)
+        {
+            include(sweep.minimum, sweep.maximum, binBounds[b].minimum, binBounds[b].maximum);
+            sweepCount += binCounts[b];
+            if (sweepCount == 0 || sweepCount == count)
+            {
+                continue;
+            }
+            const float cost = getHalfArea(sweep.minimum, sweep.maximum) * sweepCount + rightCost[b];
+            if (cost < bestCost)
+            {
+                bestCost  = cost;
+                bestSplit = b;
+            }
+        }
+
+        if (bestCost < FLT_MAX)
+        {
+            // Leaf is kept if no split is cheaper than testing all of its facets
+            const float area = getHalfArea(bounds.minimum, bounds.maximum);
+            if (count <= kBvhMaxLeafSize && area > 0.0f && kBvhTraversalCost + bestCost / area >= count)
+            {
+                return nodeIndex;
+            }
+            mid = static_cast<uint32_t>(std::partition(mFacetOrder.begin() + begin, mFacetOrder.begin() + end,
+                                                       [&](uint32_t f) { return getBin(f) <= bestSplit; }) -
+                                        mFacetOrder.begin());
+        }
+    }
+    if (mid == begin || mid == end)
+    {
+        // All centroids in one bin, split in the middle
+        mid = begin + count / 2;
+        std::nth_element(mFacetOrder.begin() + begin, mFacetOrder.begin() + mid, mFacetOrder.begin() + end,
+                         [&](uint32_t a, uint32_t b) { return mCentroids[a * 3 + axis] < mCentroids[b * 3 + axis]; });
+    }
+
+    build(begin, mid);
+    const uint32_t right = build(mid, end);
+    mNodes[nodeIndex].first = right;
+    mNodes[nodeIndex].count = 0;
+    return nodeIndex;
+}
+
+template <typename Overlap>
+void BvhAccelerator::query(const Overlap& overlap)
+{
+    mResult.clear();
+    mResultIndex = 0;
+    if (mNodes.empty())
+    {
+        return;
+    }
+    mStack.clear();
+    mStack.push_back(0);
+    while (!mStack.empty())
+    {
+        const uint32_t nodeIndex = mStack.back();
+        const Node& node         = mNodes[nodeIndex];
+        mStack.pop_back();
+        if (!overlap(node.bounds))
+        {
+            continue;
+        }
+        if (node.count == 0)
+        {
+            mStack.push_back(node.first);
+            mStack.push_back(nodeIndex + 1);
+            continue;
+        }
+        for (uint32_t i = node.first; i < node.first + node.count; ++i)
+        {
+            if (overlap(mFacetBounds[mFacetOrder[i]]))
+            {
+                mResult.push_back(static_cast<int32_t>(mFacetOrder[i]));
+            }
+        }
+    }
+    std::sort(mResult.begin(), mResult.end());
+}
+
+float BvhAccelerator::getMargin(const Box& box) const
+{
+    float maxAbs = mMaxAbsCoordinate;
+    for (uint32_t a = 0; a < 3; ++a)
+    {
+        maxAbs = std::max(maxAbs, std::max(fabsf(box.minimum[a]), fabsf(box.maximum[a])));
+    }
+    return kBvhRelativeMargin * (maxAbs + 1.0f);
+}
+
+void BvhAccelerator::release()
+{
+    delete this;
+}
+
+int32_t BvhAccelerator::getNextFacet()
+{
+    return mResultIndex < mResult.size() ? mResult[mResultIndex++] : -1;
+}
+
+void BvhAccelerator::setState(const NvcBounds3* bounds)
+{
+    Box q = { { bounds->minimum.x, bounds->minimum.y, bounds->minimum.z },
+              { bounds->maximum.x, bounds->maximum.y, bounds->maximum.z } };
+    const float margin = getMargin(q);
+    for (uint32_t a = 0; a < 3; ++a)
+    {
+        q.minimum[a] -= margin;
+        q.maximum[a] += margin;
+    }
+    query([&q](const Box& b)
+    {
+        return b.maximum[0] >= q.minimum[0] && b.minimum[0] <= q.maximum[0] && b.maximum[1] >= q.minimum[1] &&
+               b.minimum[1] <= q.maximum[1] && b.maximum[2] >= q.minimum[2] && b.minimum[2] <= q.maximum[2];
+    });
+}
+
+void BvhAccelerator::setState(const Vertex* pos, const Edge* ed, const Facet& fc)
+{
+    NvcBounds3 bounds;
+    bounds.minimum = bounds.maximum = pos[ed[fc.firstEdgeNumber].s].p;
+    for (uint32_t e = fc.firstEdgeNumber; e < fc.firstEdgeNumber + fc.edgesCount; ++e)
+    {
+        const NvcVec3& p = pos[ed[e].s].p;
+        bounds.minimum   = { std::min(bounds.minimum.x, p.x), std::min(bounds.minimum.y, p.y), std::min(bounds.minimum.z, p.z) };
+        bounds.maximum   = { std::max(bounds.maximum.x, p.x), std::max(bounds.maximum.y, p.y), std::max(bounds.maximum.z, p.z) };
+    }
+    setState(&bounds);
+}
+
+void BvhAccelerator::setState(const NvcVec3& point)
+{
+    /**
+        Facets shadowing the point along Z, see shadowing02/shadowing20. X range is compared exactly,
+        facets outside of Y range get zero status anyway, so only Y needs a margin.
+    */
+    const Box q        = { { point.x, point.y, point.z }, { point.x, point.y, point.z } };
+    const float margin = getMargin(q);
+    query([&point, margin](const Box& b)
+    {
+        return b.minimum[0] <= point.x && b.maximum[0] >= point.x && b.minimum[1] - margin <= point.y &&
+               b.maximum[1] + margin >= point.y;
+    });
+}
+
+SpatialAccelerator* createDefaultAccelerator(const Mesh* mesh)
+{
+    if (mesh->getFacetCount() >= kBvhAcceleratorMinFacetCount)
+    {
+        return new BvhAccelerator(mesh);
+    }
+    return new DummyAccelerator(mesh->getFacetCount());
+}
+
+}  // namespace Blast
+}  // namespace Nv
@@ -0,0 +1,101 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#ifndef NVBLASTEXTAUTHORINGBVHACCELERATOR_H
+#define NVBLASTEXTAUTHORINGBVHACCELERATOR_H
+
+#include "NvBlastExtAuthoringAcceleratorImpl.h"
+#include <vector>
+
+namespace Nv
+{
+namespace Blast
+{
+
+/**
+    Minimal facet count of a mesh for which BvhAccelerator is used by default, smaller meshes are tested facet by facet.
+*/
+const uint32_t kBvhAcceleratorMinFacetCount = 64;
+
+/**
+    Spatial accelerator backed by bounding volume hierarchy over facet bounds, built with surface area heuristic.
+    Queries return facets in ascending order, the same as DummyAccelerator, minus facets which can't affect
+    boolean evaluation:
+    - setState(facet) and setState(bounds) return facets whose bounds overlap query bounds,
+    - setState(point) returns facets whose XY bounds contain the point.
+    Bounds are expanded by a small margin, interpolated points of BooleanEvaluator may be off by a few ulps.
+*/
+class BvhAccelerator : public SpatialAccelerator
+{
+public:
+    BvhAccelerator();
+    BvhAccelerator(const Mesh* mesh);
+
+    /**
+        Build hierarchy for another mesh, buffers are kept, so an accelerator rebuilt for meshes of similar size
+        doesn't allocate.
+    */
+    void        rebuild(const Mesh* mesh);
+
+    void        release() override;
+    int32_t     getNextFacet() override;
+    void        setState(const NvcBounds3* bounds) override;
+    void        setState(const Vertex* pos, const Edge* ed, const Facet& fc) override;
+    void        setState(const NvcVec3& point) override;
+
+private:
+    struct Box
+    {
+        float minimum[3];
+        float maximum[3];
+    };
+
+    /**
+        Internal node has count == 0, its children are next node and node 'first'. Leaf holds facets
+        mFacetOrder[first] .. mFacetOrder[first + count - 1].
+    */
+    struct Node
+    {
+        Box         bounds;
+        uint32_t    first;
+        uint32_t    count;
+    };
+
+    uint32_t    build(uint32_t begin, uint32_t end);
+    template <typename Overlap>
+    void        query(const Overlap& overlap);
+    float       getMargin(const Box& box) const;
+
+    std::vector<Box>        mFacetBounds;
+    std::vector<float>      mCentroids;
+    std::vector<uint32_t>   mFacetOrder;
+    std::vector<Node>       mNodes;
+    float                   mMaxAbsCoordinate;
+
+    std::vector<int32_t>    mResult;
+    uint32_t                mResultIndex;
+    std::vector<uint32_t>   mStack;
+};
+
+/**
+    Create accelerator used for mesh by default: BvhAccelerator for meshes with at least kBvhAcceleratorMinFacetCount
+    facets, DummyAccelerator otherwise. User's code should release it after usage.
+*/
+SpatialAccelerator* createDefaultAccelerator(const Mesh* mesh);
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGBVHACCELERATOR_H
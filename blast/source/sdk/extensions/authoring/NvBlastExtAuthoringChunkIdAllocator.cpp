@@ -0,0 +1,166 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+
+#include "NvBlastExtAuthoringChunkIdAllocator.h"
+#include <algorithm>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+    Bitset grows to take an ID if it needs at most this many words more than doubling
+*/
+#define CHUNK_ID_DENSE_SLACK_WORDS 64
+
+namespace Nv
+{
+namespace Blast
+{
+
+static inline uint32_t getLowestBit(uint64_t bits)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return index;
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+ChunkIdAllocator::ChunkIdAllocator() : mNext(0), mUsedCount(0) {}
+
+void ChunkIdAllocator::reset()
+{
+    mDense.clear();
+    mSparse.clear();
+    mNext      = 0;
+    mUsedCount = 0;
+}
+
+int32_t ChunkIdAllocator::create()
+{
+    if (mUsedCount >= (uint64_t)INT32_MAX + 1)
+    {
+        return -1;
+    }
+
+    int64_t id = mNext;
+    for (;;)
+    {
+        // Skip used IDs of the bitset a word at a time
+        uint64_t word = id >> 6;
+        if (word < mDense.size())
+        {
+            uint64_t bits = ~mDense[word] & (~0ull << (id & 63));
+            while (bits == 0 && ++word < mDense.size())
+            {
+                bits = ~mDense[word];
+            }
+            id = bits != 0 ? (int64_t)(word * 64 + getLowestBit(bits)) : (int64_t)mDense.size() * 64;
+        }
+        if (id > INT32_MAX)
+        {
+            id = 0;
+            continue;
+        }
+        if (isDense(id) || mSparse.count((int32_t)id) == 0)
+        {
+            break;
+        }
+        ++id;
+    }
+
+    mNext = id < INT32_MAX ? (int32_t)id + 1 : 0;
+    reserve((int32_t)id);
+    return (int32_t)id;
+}
+
+bool ChunkIdAllocator::reserve(int32_t id)
+{
+    if (id < 0 || isUsed(id))
+    {
+        return false;
+    }
+    if (!isDense(id) && (uint64_t)(id >> 6) < 2 * mDense.size() + CHUNK_ID_DENSE_SLACK_WORDS)
+    {
+        growDense(id);
+    }
+    if (isDense(id))
+    {
+        mDense[id >> 6] |= 1ull << (id & 63);
+    }
+    else
+    {
+        mSparse.insert(id);
+    }
+    ++mUsedCount;
+    return true;
+}
+
+void ChunkIdAllocator::release(int32_t id)
+{
+    if (!isUsed(id))
+    {
+        return;
+    }
+    if (isDense(id))
+    {
+        mDense[id >> 6] &= ~(1ull << (id & 63));
+    }
+    else
+    {
+        mSparse.erase(id);
+    }
+    --mUsedCount;
+}
+
+bool ChunkIdAllocator::isUsed(int32_t id) const
+{
+    if (id < 0)
+    {
+        return false;
+    }
+    if (isDense(id))
+    {
+        return (mDense[id >> 6] >> (id & 63)) & 1;
+    }
+    return mSparse.count(id) != 0;
+}
+
+void ChunkIdAllocator::growDense(int64_t id)
+{
+    const size_t oldWordCount = mDense.size();
+    const size_t wordCount    = std::min<size_t>(std::max<size_t>(2 * oldWordCount, (size_t)(id >> 6) + 1),
+                                                 ((size_t)INT32_MAX + 1) / 64);
+    mDense.resize(wordCount, 0);
+
+    // Move sparse IDs covered by the bitset now
+    auto end = mSparse.lower_bound((int32_t)std::min<int64_t>((int64_t)wordCount * 64, INT32_MAX));
+    if (wordCount * 64 > (size_t)INT32_MAX)
+    {
+        end = mSparse.end();
+    }
+    for (auto it = mSparse.begin(); it != end; ++it)
+    {
+        mDense[*it >> 6] |= 1ull << (*it & 63);
+    }
+    mSparse.erase(mSparse.begin(), end);
+}
+
+}  // namespace Blast
+}  // namespace Nv
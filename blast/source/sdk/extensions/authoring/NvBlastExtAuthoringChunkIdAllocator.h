@@ -0,0 +1,76 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+
+#ifndef NVBLASTEXTAUTHORINGCHUNKIDALLOCATOR_H
+#define NVBLASTEXTAUTHORINGCHUNKIDALLOCATOR_H
+
+#include <stdint.h>
+#include <set>
+#include <vector>
+
+namespace Nv
+{
+namespace Blast
+{
+
+/**
+    Chunk IDs in use. IDs are created by next fit: the first free ID at or after the one following the last created
+    ID, wrapping to 0 after INT32_MAX. Released IDs are free again, so they are taken once the search wraps.
+    Used IDs are kept in a bitset, which grows with the highest ID. IDs reserved far beyond it are kept in a set
+    until the bitset reaches them.
+*/
+class ChunkIdAllocator
+{
+public:
+    ChunkIdAllocator();
+
+    /**
+        Release all IDs, next created ID is 0.
+    */
+    void        reset();
+
+    /**
+        Create an ID, -1 if all IDs are in use.
+    */
+    int32_t     create();
+
+    /**
+        Mark the given ID as used. Returns false if it is already in use or negative.
+    */
+    bool        reserve(int32_t id);
+
+    /**
+        Mark the given ID as free.
+    */
+    void        release(int32_t id);
+
+    bool        isUsed(int32_t id) const;
+
+private:
+    bool        isDense(int64_t id) const { return id < (int64_t)mDense.size() * 64; }
+    void        growDense(int64_t id);
+
+    std::vector<uint64_t>   mDense;     // Bit per ID in [0, 64 * mDense.size())
+    std::set<int32_t>       mSparse;    // Used IDs beyond mDense
+    int32_t                 mNext;
+    uint64_t                mUsedCount;
+};
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGCHUNKIDALLOCATOR_H
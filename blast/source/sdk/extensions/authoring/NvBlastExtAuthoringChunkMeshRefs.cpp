@@ -0,0 +1,100 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+
+
+#include "NvBlastExtAuthoringChunkMeshRefs.h"
+#include "NvBlastExtAuthoringMeshImpl.h"
+#include "NvBlastExtAuthoringTriangulator.h"
+
+namespace Nv
+{
+namespace Blast
+{
+
+static void acquireOwner(std::unordered_map<const void*, uint32_t>& extraOwners, const void* object)
+{
+    if (object != nullptr)
+    {
+        ++extraOwners[object];
+    }
+}
+
+/**
+    Remove an owner of object, returns true if it was the last one
+*/
+static bool releaseOwner(std::unordered_map<const void*, uint32_t>& extraOwners, const void* object)
+{
+    auto it = extraOwners.find(object);
+    if (it == extraOwners.end())
+    {
+        return object != nullptr;
+    }
+    if (--it->second == 0)
+    {
+        extraOwners.erase(it);
+    }
+    return false;
+}
+
+void ChunkMeshRefs::acquire(Mesh* mesh)
+{
+    acquireOwner(mExtraOwners, mesh);
+}
+
+void ChunkMeshRefs::release(Mesh* mesh)
+{
+    if (releaseOwner(mExtraOwners, mesh))
+    {
+        delete mesh;
+    }
+}
+
+Mesh* ChunkMeshRefs::makeWritable(Mesh* mesh)
+{
+    if (mesh == nullptr || !isShared(mesh))
+    {
+        return mesh;
+    }
+    releaseOwner(mExtraOwners, mesh);
+    return new MeshImpl(*reinterpret_cast<const MeshImpl*>(mesh));
+}
+
+void ChunkMeshRefs::acquire(Triangulator* triangulator)
+{
+    acquireOwner(mExtraOwners, triangulator);
+}
+
+void ChunkMeshRefs::release(Triangulator* triangulator)
+{
+    if (releaseOwner(mExtraOwners, triangulator))
+    {
+        delete triangulator;
+    }
+}
+
+Triangulator* ChunkMeshRefs::makeWritable(Triangulator* triangulator)
+{
+    if (triangulator == nullptr || !isShared(triangulator))
+    {
+        return triangulator;
+    }
+    releaseOwner(mExtraOwners, triangulator);
+    return new Triangulator(*triangulator);
+}
+
+}  // namespace Blast
+}  // namespace Nv
@@ -0,0 +1,71 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+
+
+#ifndef NVBLASTEXTAUTHORINGCHUNKMESHREFS_H
+#define NVBLASTEXTAUTHORINGCHUNKMESHREFS_H
+
+#include <stdint.h>
+#include <unordered_map>
+
+namespace Nv
+{
+namespace Blast
+{
+
+class Mesh;
+class Triangulator;
+
+/**
+    Owners of chunk meshes and triangulators. A chunk mesh can be owned by several chunks (of the fracture tool and
+    of its snapshots), owners are counted only for meshes with more than one. Shared meshes are read only: an owner
+    that changes its mesh takes its own copy first, so meshes are copied only when a shared one is actually written.
+    Triangulators of finalized chunks are owned the same way.
+    Not thread safe, owners are added and released on the calling thread.
+*/
+class ChunkMeshRefs
+{
+public:
+    /**
+        Add an owner of mesh, which has at least one owner already.
+    */
+    void        acquire(Mesh* mesh);
+
+    /**
+        Remove an owner of mesh, mesh is deleted with its last owner.
+    */
+    void        release(Mesh* mesh);
+
+    bool        isShared(const void* object) const { return mExtraOwners.find(object) != mExtraOwners.end(); }
+
+    /**
+        Mesh the owner can write: mesh itself if the owner is the only one, otherwise a copy owned by it alone.
+    */
+    Mesh*       makeWritable(Mesh* mesh);
+
+    void            acquire(Triangulator* triangulator);
+    void            release(Triangulator* triangulator);
+    Triangulator*   makeWritable(Triangulator* triangulator);
+
+private:
+    std::unordered_map<const void*, uint32_t>   mExtraOwners;   // Owners beyond the first, shared objects only
+};
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGCHUNKMESHREFS_H
@@ -0,0 +1,332 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#include "NvBlastExtAuthoringConvexCell.h"
+#include "NvBlastExtAuthoringMeshClipper.h"
+#include "NvBlastExtAuthoringMeshImpl.h"
+#include <algorithm>
+#include <math.h>
+
+namespace Nv
+{
+namespace Blast
+{
+
+ConvexCell::ConvexCell() : mEpsilon(0.0)
+{
+}
+
+void ConvexCell::init(const NvcVec3& minimum, const NvcVec3& maximum)
+{
+    mFaces.clear();
+    mVertices.clear();
+
+    const double mn[3] = { minimum.x, minimum.y, minimum.z };
+    const double mx[3] = { maximum.x, maximum.y, maximum.z };
+    const double diagonal = sqrt((mx[0] - mn[0]) * (mx[0] - mn[0]) + (mx[1] - mn[1]) * (mx[1] - mn[1]) +
+                                 (mx[2] - mn[2]) * (mx[2] - mn[2]));
+    mEpsilon = 1e-10 * std::max(diagonal, 1e-6);
+
+    /**
+        For face with normal along axis a, u and v axes are picked so that u x v is the outward normal
+    */
+    for (uint32_t axis = 0; axis < 3; ++axis)
+    {
+        for (int32_t side = 0; side < 2; ++side)
+        {
+            uint32_t u = (axis + 1) % 3;
+            uint32_t v = (axis + 2) % 3;
+            if (side == 0)
+            {
+                std::swap(u, v);
+            }
+            Face face;
+            face.n[0] = face.n[1] = face.n[2] = 0.0;
+            face.n[axis]     = side == 0 ? -1.0 : 1.0;
+            face.tag         = BoxFaceTag;
+            face.userData    = 0;
+            face.firstVertex = static_cast<uint32_t>(mVertices.size());
+            face.vertexCount = 4;
+
+            const double uc[4] = { mn[u], mx[u], mx[u], mn[u] };
+            const double vc[4] = { mn[v], mn[v], mx[v], mx[v] };
+            for (uint32_t k = 0; k < 4; ++k)
+            {
+                double p[3];
+                p[axis] = side == 0 ? mn[axis] : mx[axis];
+                p[u]    = uc[k];
+                p[v]    = vc[k];
+                mVertices.push_back({ p[0], p[1], p[2] });
+            }
+            mFaces.push_back(face);
+        }
+    }
+}
+
+bool ConvexCell::clip(const double n[3], double d, int32_t tag, int64_t userData)
+{
+    if (mFaces.empty())
+    {
+        return false;
+    }
+
+    bool anyOutside = false;
+    bool anyInside  = false;
+    mDistances.resize(mVertices.size());
+    for (uint32_t i = 0; i < mVertices.size(); ++i)
+    {
+        const Point& p = mVertices[i];
+        mDistances[i]  = n[0] * p.x + n[1] * p.y + n[2] * p.z + d;
+        if (mDistances[i] > mEpsilon)
+        {
+            anyOutside = true;
+        }
+        else
+        {
+            anyInside = true;
+        }
+    }
+    if (!anyOutside)
+    {
+        return true;
+    }
+    if (!anyInside)
+    {
+        mFaces.clear();
+        mVertices.clear();
+        return false;
+    }
+
+    mNewFaces.clear();
+    mNewVertices.clear();
+    mCapPoints.clear();
+    for (const Face& face : mFaces)
+    {
+        Face clipped        = face;
+        clipped.firstVertex = static_cast<uint32_t>(mNewVertices.size());
+        for (uint32_t k = 0; k < face.vertexCount; ++k)
+        {
+            const uint32_t ia = face.firstVertex + k;
+            const uint32_t ib = face.firstVertex + (k + 1) % face.vertexCount;
+            const double da   = mDistances[ia];
+            const double db   = mDistances[ib];
+            const bool outA   = da > mEpsilon;
+            const bool outB   = db > mEpsilon;
+            if (!outA)
+            {
+                mNewVertices.push_back(mVertices[ia]);
+                if (da >= -mEpsilon)
+                {
+                    mCapPoints.push_back(mVertices[ia]);
+                }
+            }
+            if (outA != outB)
+            {
+                // An inside end lying on the plane is emitted by itself, no need for an intersection point
+                if ((outA ? db : da) < -mEpsilon)
+                {
+                    // Interpolate from the same end for both faces sharing the edge, so the points match exactly
+                    const bool fromA = mVertices[ia].x < mVertices[ib].x ||
+                                       (mVertices[ia].x == mVertices[ib].x &&
+                                        (mVertices[ia].y < mVertices[ib].y ||
+                                         (mVertices[ia].y == mVertices[ib].y && mVertices[ia].z < mVertices[ib].z)));
+                    const Point& s = fromA ? mVertices[ia] : mVertices[ib];
+                    const Point& e = fromA ? mVertices[ib] : mVertices[ia];
+                    const double ds = fromA ? da : db;
+                    const double de = fromA ? db : da;
+                    const double t  = ds / (ds - de);
+                    const Point p   = { s.x + (e.x - s.x) * t, s.y + (e.y - s.y) * t, s.z + (e.z - s.z) * t };
+                    mNewVertices.push_back(p);
+                    mCapPoints.push_back(p);
+                }
+            }
+        }
+        clipped.vertexCount = static_cast<uint32_t>(mNewVertices.size()) - clipped.firstVertex;
+        if (clipped.vertexCount >= 3)
+        {
+            mNewFaces.push_back(clipped);
+        }
+        else
+        {
+            mNewVertices.resize(clipped.firstVertex);
+        }
+    }
+    mFaces.swap(mNewFaces);
+    mVertices.swap(mNewVertices);
+
+    addCapFace(n, tag, userData);
+    if (mFaces.size() < 4)
+    {
+        mFaces.clear();
+        mVertices.clear();
+    }
+    return !mFaces.empty();
+}
+
+bool ConvexCell::clipBisector(const NvcVec3& site, const NvcVec3& other, int32_t tag, int64_t userData)
+{
+    double n[3]         = { (double)other.x - site.x, (double)other.y - site.y, (double)other.z - site.z };
+    const double length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+    if (length <= mEpsilon)
+    {
+        return !mFaces.empty();
+    }
+    n[0] /= length;
+    n[1] /= length;
+    n[2] /= length;
+    const double d = -(n[0] * 0.5 * ((double)site.x + other.x) + n[1] * 0.5 * ((double)site.y + other.y) +
+                       n[2] * 0.5 * ((double)site.z + other.z));
+    return clip(n, d, tag, userData);
+}
+
+void ConvexCell::getFacePlane(uint32_t face, int32_t materialId, ClipPlane& plane) const
+{
+    const Face& f     = mFaces[face];
+    const Point& p    = mVertices[f.firstVertex];
+    plane.n[0]        = f.n[0];
+    plane.n[1]        = f.n[1];
+    plane.n[2]        = f.n[2];
+    plane.d           = -(f.n[0] * p.x + f.n[1] * p.y + f.n[2] * p.z);
+    getPlaneBasis(f.n, plane.u, plane.v);
+    plane.capNormal   = { (float)f.n[0], (float)f.n[1], (float)f.n[2] };
+    plane.userData    = f.userData;
+    plane.materialId  = materialId;
+}
+
+double ConvexCell::getMaxSquaredDistance(const NvcVec3& point) const
+{
+    double result = 0.0;
+    for (const Point& p : mVertices)
+    {
+        const double dx = p.x - point.x;
+        const double dy = p.y - point.y;
+        const double dz = p.z - point.z;
+        result          = std::max(result, dx * dx + dy * dy + dz * dz);
+    }
+    return result;
+}
+
+void ConvexCell::addCapFace(const double n[3], int32_t tag, int64_t userData)
+{
+    if (mCapPoints.size() < 3)
+    {
+        return;
+    }
+
+    /**
+        Cap of a convex cell is a convex polygon, order its points by angle around centroid
+    */
+    Point c = { 0.0, 0.0, 0.0 };
+    for (const Point& p : mCapPoints)
+    {
+        c.x += p.x;
+        c.y += p.y;
+        c.z += p.z;
+    }
+    c.x /= mCapPoints.size();
+    c.y /= mCapPoints.size();
+    c.z /= mCapPoints.size();
+
+    // u x v = n, so increasing angle is counter clockwise around n
+    double u[3], v[3];
+    getPlaneBasis(n, u, v);
+
+    mCapOrder.clear();
+    for (uint32_t i = 0; i < mCapPoints.size(); ++i)
+    {
+        const double dx = mCapPoints[i].x - c.x;
+        const double dy = mCapPoints[i].y - c.y;
+        const double dz = mCapPoints[i].z - c.z;
+        mCapOrder.push_back(std::make_pair(atan2(dx * v[0] + dy * v[1] + dz * v[2], dx * u[0] + dy * u[1] + dz * u[2]), i));
+    }
+    std::sort(mCapOrder.begin(), mCapOrder.end());
+
+    Face face;
+    face.n[0]        = n[0];
+    face.n[1]        = n[1];
+    face.n[2]        = n[2];
+    face.tag         = tag;
+    face.userData    = userData;
+    face.firstVertex = static_cast<uint32_t>(mVertices.size());
+
+    const double eps2 = mEpsilon * mEpsilon;
+    auto isSame = [eps2](const Point& a, const Point& b)
+    {
+        return (a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y) + (a.z - b.z) * (a.z - b.z) <= eps2;
+    };
+    for (const auto& o : mCapOrder)
+    {
+        const Point& p = mCapPoints[o.second];
+        if (mVertices.size() > face.firstVertex && isSame(mVertices.back(), p))
+        {
+            continue;
+        }
+        mVertices.push_back(p);
+    }
+    while (mVertices.size() > face.firstVertex + 1 && isSame(mVertices.back(), mVertices[face.firstVertex]))
+    {
+        mVertices.pop_back();
+    }
+
+    face.vertexCount = static_cast<uint32_t>(mVertices.size()) - face.firstVertex;
+    if (face.vertexCount >= 3)
+    {
+        mFaces.push_back(face);
+    }
+    else
+    {
+        mVertices.resize(face.firstVertex);
+    }
+}
+
+Mesh* ConvexCell::createMesh(int32_t materialId) const
+{
+    if (mFaces.empty())
+    {
+        return nullptr;
+    }
+
+    std::vector<Vertex> vertices(mVertices.size());
+    std::vector<Edge> edges(mVertices.size());
+    std::vector<Facet> facets(mFaces.size());
+    for (uint32_t f = 0; f < mFaces.size(); ++f)
+    {
+        const Face& face = mFaces[f];
+        double u[3], v[3];
+        getPlaneBasis(face.n, u, v);
+        const NvcVec3 normal = { (float)face.n[0], (float)face.n[1], (float)face.n[2] };
+        for (uint32_t k = 0; k < face.vertexCount; ++k)
+        {
+            const uint32_t index = face.firstVertex + k;
+            const Point& p       = mVertices[index];
+            vertices[index].p    = { (float)p.x, (float)p.y, (float)p.z };
+            vertices[index].n    = normal;
+            vertices[index].uv[0] = { (float)(p.x * u[0] + p.y * u[1] + p.z * u[2]),
+                                      (float)(p.x * v[0] + p.y * v[1] + p.z * v[2]) };
+            edges[index].s       = index;
+            edges[index].e       = face.firstVertex + (k + 1) % face.vertexCount;
+        }
+        facets[f].firstEdgeNumber = face.firstVertex;
+        facets[f].edgesCount      = face.vertexCount;
+        facets[f].userData        = face.userData;
+        facets[f].materialId      = materialId;
+        facets[f].smoothingGroup  = -1;
+    }
+    return new MeshImpl(vertices.data(), edges.data(), facets.data(), static_cast<uint32_t>(vertices.size()),
+                        static_cast<uint32_t>(edges.size()), static_cast<uint32_t>(facets.size()));
+}
+
+}  // namespace Blast
+}  // namespace Nv
@@ -0,0 +1,126 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#ifndef NVBLASTEXTAUTHORINGCONVEXCELL_H
+#define NVBLASTEXTAUTHORINGCONVEXCELL_H
+
+#include "NvBlastExtAuthoringTypes.h"
+#include <vector>
+
+namespace Nv
+{
+namespace Blast
+{
+
+class Mesh;
+struct ClipPlane;
+
+/**
+    Convex polytope obtained by clipping an axis aligned box with half-spaces, used to build voronoi cells
+    directly from bisector planes. Faces are stored as convex polygons wound counter clockwise around the
+    outward normal. All computations are done in double precision.
+*/
+class ConvexCell
+{
+public:
+    /**
+        Tag of faces which come from the initial box.
+    */
+    static const int32_t BoxFaceTag = -1;
+
+    ConvexCell();
+
+    /**
+        Reset cell to axis aligned box.
+        \param[in] minimum  Box minimum corner
+        \param[in] maximum  Box maximum corner
+    */
+    void                init(const NvcVec3& minimum, const NvcVec3& maximum);
+
+    /**
+        Clip cell with half-space n.x + d <= 0.
+        \param[in] n        Normalized plane normal, it becomes outward normal of the new face
+        \param[in] d        Plane offset
+        \param[in] tag      Tag stored for the new face, e.g. index of neighbor site
+        \param[in] userData Facet user data stored for the new face
+        \return false if cell became empty
+    */
+    bool                clip(const double n[3], double d, int32_t tag, int64_t userData);
+
+    /**
+        Clip cell with bisector plane of two sites, the part closer to site is kept.
+        \return false if cell became empty
+    */
+    bool                clipBisector(const NvcVec3& site, const NvcVec3& other, int32_t tag, int64_t userData);
+
+    bool                isEmpty() const { return mFaces.empty(); }
+
+    /**
+        Squared distance from point to the farthest cell vertex.
+    */
+    double              getMaxSquaredDistance(const NvcVec3& point) const;
+
+    uint32_t            getFaceCount() const { return static_cast<uint32_t>(mFaces.size()); }
+    int32_t             getFaceTag(uint32_t face) const { return mFaces[face].tag; }
+
+    /**
+        Get plane of face for MeshClipper, cell is on the inside. Cap attributes are the same as createMesh(...) gives to the face.
+        \param[in]  face        Face index
+        \param[in]  materialId  Material id of cap facets
+        \param[out] plane       Face plane
+    */
+    void                getFacePlane(uint32_t face, int32_t materialId, ClipPlane& plane) const;
+
+    /**
+        Create mesh of the cell. Each face becomes a facet with its own vertices, face user data is stored
+        in facet userData, interior UVs are planar projection on the face.
+        \param[in] materialId  Material id of all facets
+        \return nullptr if cell is empty
+    */
+    Mesh*               createMesh(int32_t materialId) const;
+
+private:
+    struct Point
+    {
+        double x, y, z;
+    };
+
+    struct Face
+    {
+        double      n[3];
+        int32_t     tag;
+        int64_t     userData;
+        uint32_t    firstVertex;
+        uint32_t    vertexCount;
+    };
+
+    void                addCapFace(const double n[3], int32_t tag, int64_t userData);
+
+    std::vector<Face>   mFaces;
+    std::vector<Point>  mVertices;
+    double              mEpsilon;
+
+    /* Scratch buffers, kept between clips to avoid allocations */
+    std::vector<Face>   mNewFaces;
+    std::vector<Point>  mNewVertices;
+    std::vector<double> mDistances;
+    std::vector<Point>  mCapPoints;
+    std::vector<std::pair<double, uint32_t>> mCapOrder;
+};
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGCONVEXCELL_H
@@ -0,0 +1,316 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#include "NvBlastExtAuthoringEdgeCulling.h"
+#include "NvBlastExtAuthoringMesh.h"
+#include <NvBlastAssert.h>
+#include <algorithm>
+#include <math.h>
+#include <float.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NV_EDGE_CULLING_SSE 1
+#include <emmintrin.h>
+#else
+#define NV_EDGE_CULLING_SSE 0
+#endif
+
+#if NV_EDGE_CULLING_SSE && (defined(_MSC_VER) || defined(__GNUC__))
+#define NV_EDGE_CULLING_AVX 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define NV_EDGE_CULLING_AVX_TARGET
+#else
+#define NV_EDGE_CULLING_AVX_TARGET __attribute__((target("avx")))
+#endif
+#else
+#define NV_EDGE_CULLING_AVX 0
+#endif
+
+namespace Nv
+{
+namespace Blast
+{
+
+struct BoundsPointers
+{
+    const float* minX;
+    const float* maxX;
+    const float* minY;
+    const float* maxY;
+};
+
+typedef uint32_t (*MarkOverlappingKernel)(const BoundsPointers& boxes, uint32_t first, uint32_t count,
+                                          const float bounds[4], uint8_t* overlap);
+
+/**
+    Box overlaps bounds unless it is strictly left, right, below or above them.
+*/
+static inline uint8_t isOverlapping(const BoundsPointers& boxes, uint32_t box, const float bounds[4])
+{
+    return (boxes.maxX[box] >= bounds[0] && boxes.minX[box] <= bounds[1] && boxes.maxY[box] >= bounds[2] &&
+            boxes.minY[box] <= bounds[3]) ? 1 : 0;
+}
+
+static uint32_t markOverlappingScalar(const BoundsPointers& boxes, uint32_t first, uint32_t count, const float bounds[4],
+                                      uint8_t* overlap)
+{
+    uint32_t result = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        overlap[i] = isOverlapping(boxes, first + i, bounds);
+        result += overlap[i];
+    }
+    return result;
+}
+
+#if NV_EDGE_CULLING_SSE
+static uint32_t markOverlappingSSE(const BoundsPointers& boxes, uint32_t first, uint32_t count, const float bounds[4],
+                                   uint8_t* overlap)
+{
+    const __m128 fMinX = _mm_set1_ps(bounds[0]);
+    const __m128 fMaxX = _mm_set1_ps(bounds[1]);
+    const __m128 fMinY = _mm_set1_ps(bounds[2]);
+    const __m128 fMaxY = _mm_set1_ps(bounds[3]);
+    uint32_t result = 0;
+    uint32_t i      = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32_t b = first + i;
+        __m128 mask = _mm_cmpge_ps(_mm_loadu_ps(boxes.maxX + b), fMinX);
+        mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_loadu_ps(boxes.minX + b), fMaxX));
+        mask = _mm_and_ps(mask, _mm_cmpge_ps(_mm_loadu_ps(boxes.maxY + b), fMinY));
+        mask = _mm_and_ps(mask, _mm_cmple_ps(_mm_loadu_ps(boxes.minY + b), fMaxY));
+        const int32_t bits = _mm_movemask_ps(mask);
+        for (uint32_t k = 0; k < 4; ++k)
+        {
+            overlap[i + k] = (bits >> k) & 1;
+            result += overlap[i + k];
+        }
+    }
+    return result + markOverlappingScalar(boxes, first + i, count - i, bounds, overlap + i);
+}
+#endif
+
+#if NV_EDGE_CULLING_AVX
+NV_EDGE_CULLING_AVX_TARGET
+static uint32_t markOverlappingAVX(const BoundsPointers& boxes, uint32_t first, uint32_t count, const float bounds[4],
+                                   uint8_t* overlap)
+{
+    const __m256 fMinX = _mm256_set1_ps(bounds[0]);
+    const __m256 fMaxX = _mm256_set1_ps(bounds[1]);
+    const __m256 fMinY = _mm256_set1_ps(bounds[2]);
+    const __m256 fMaxY = _mm256_set1_ps(bounds[3]);
+    uint32_t result = 0;
+    uint32_t i      = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint32_t b = first + i;
+        __m256 mask = _mm256_cmp_ps(_mm256_loadu_ps(boxes.maxX + b), fMinX, _CMP_GE_OQ);
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_loadu_ps(boxes.minX + b), fMaxX, _CMP_LE_OQ));
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_loadu_ps(boxes.maxY + b), fMinY, _CMP_GE_OQ));
+        mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_loadu_ps(boxes.minY + b), fMaxY, _CMP_LE_OQ));
+        const int32_t bits = _mm256_movemask_ps(mask);
+        for (uint32_t k = 0; k < 8; ++k)
+        {
+            overlap[i + k] = (bits >> k) & 1;
+            result += overlap[i + k];
+        }
+    }
+    _mm256_zeroupper();
+    return result + markOverlappingSSE(boxes, first + i, count - i, bounds, overlap + i);
+}
+
+static bool isAvxSupported()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx     = (info[2] & (1 << 28)) != 0;
+    return osxsave && avx && (_xgetbv(0) & 6) == 6;
+#else
+    // cpu model may not be initialized yet when called before main
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx") != 0;
+#endif
+}
+#endif
+
+#if NV_DEBUG || NV_CHECKED
+/**
+    Compare kernel with the scalar one on boxes with coordinates from a small set, so that boxes touching the bounds
+    are frequent, for every count up to two AVX packs plus remainder and every offset within a pack.
+*/
+static bool isKernelMatchingScalar(MarkOverlappingKernel kernel)
+{
+    const uint32_t boxCount = 32;
+    float coords[4][boxCount];
+    uint32_t random = 12345;
+    for (uint32_t b = 0; b < boxCount; ++b)
+    {
+        for (uint32_t c = 0; c < 2; ++c)
+        {
+            random = random * 1664525u + 1013904223u;
+            const float v0 = static_cast<float>((random >> 8) % 5) * 0.5f - 1.0f;
+            random = random * 1664525u + 1013904223u;
+            const float v1 = static_cast<float>((random >> 8) % 5) * 0.5f - 1.0f;
+            coords[c * 2][b]     = std::min(v0, v1);
+            coords[c * 2 + 1][b] = std::max(v0, v1);
+        }
+    }
+    const BoundsPointers boxes = { coords[0], coords[1], coords[2], coords[3] };
+    const float queries[3][4]  = { { -0.5f, 0.5f, -0.5f, 0.5f }, { 0.0f, 0.0f, -1.0f, 1.0f }, { 0.5f, 1.0f, -1.0f, -0.5f } };
+    uint8_t expected[boxCount], overlap[boxCount];
+    for (const float* query : queries)
+    {
+        for (uint32_t first = 0; first < 8; ++first)
+        {
+            for (uint32_t count = 0; first + count <= boxCount && count <= 19; ++count)
+            {
+                if (kernel(boxes, first, count, query, overlap) !=
+                        markOverlappingScalar(boxes, first, count, query, expected) ||
+                    !std::equal(overlap, overlap + count, expected))
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+#endif
+
+static MarkOverlappingKernel selectMarkOverlappingKernel()
+{
+    MarkOverlappingKernel kernel = markOverlappingScalar;
+#if NV_EDGE_CULLING_SSE
+    kernel = markOverlappingSSE;
+#endif
+#if NV_EDGE_CULLING_AVX
+    if (isAvxSupported())
+    {
+        kernel = markOverlappingAVX;
+    }
+#endif
+#if NV_DEBUG || NV_CHECKED
+#if NV_EDGE_CULLING_SSE
+    NVBLAST_ASSERT(isKernelMatchingScalar(markOverlappingSSE));
+#endif
+    NVBLAST_ASSERT(isKernelMatchingScalar(kernel));
+#endif
+    return kernel;
+}
+
+
+void EdgeBounds::BoundsArrays::resize(uint32_t count)
+{
+    minX.resize(count);
+    maxX.resize(count);
+    minY.resize(count);
+    maxY.resize(count);
+}
+
+void EdgeBounds::BoundsArrays::set(uint32_t index, const Bounds& bounds)
+{
+    minX[index] = bounds.minX;
+    maxX[index] = bounds.maxX;
+    minY[index] = bounds.minY;
+    maxY[index] = bounds.maxY;
+}
+
+EdgeBounds::Bounds EdgeBounds::BoundsArrays::get(uint32_t index, float yMargin) const
+{
+    const Bounds bounds = { minX[index], maxX[index], minY[index] - yMargin, maxY[index] + yMargin };
+    return bounds;
+}
+
+size_t EdgeBounds::BoundsArrays::getCapacityBytes() const
+{
+    return (minX.capacity() + maxX.capacity() + minY.capacity() + maxY.capacity()) * sizeof(float);
+}
+
+void EdgeBounds::build(const Mesh* mesh)
+{
+    const uint32_t edgeCount = mesh->getEdgesCount();
+    const Vertex* vertices   = mesh->getVertices();
+    const Edge* meshEdges    = mesh->getEdges();
+    mEdges.resize(edgeCount);
+    mMaxAbsY = 0.0f;
+    for (uint32_t i = 0; i < edgeCount; ++i)
+    {
+        const NvcVec3& s = vertices[meshEdges[i].s].p;
+        const NvcVec3& e = vertices[meshEdges[i].e].p;
+        const Bounds bounds = { std::min(s.x, e.x), std::max(s.x, e.x), std::min(s.y, e.y), std::max(s.y, e.y) };
+        mEdges.set(i, bounds);
+        mMaxAbsY = std::max(mMaxAbsY, std::max(fabsf(bounds.minY), fabsf(bounds.maxY)));
+    }
+
+    const uint32_t facetCount = mesh->getFacetCount();
+    mFacets.resize(facetCount);
+    for (uint32_t f = 0; f < facetCount; ++f)
+    {
+        const Facet* facet = mesh->getFacet(f);
+        Bounds bounds      = { FLT_MAX, -FLT_MAX, FLT_MAX, -FLT_MAX };
+        for (uint32_t i = facet->firstEdgeNumber; i < facet->firstEdgeNumber + facet->edgesCount; ++i)
+        {
+            bounds.minX = std::min(bounds.minX, mEdges.minX[i]);
+            bounds.maxX = std::max(bounds.maxX, mEdges.maxX[i]);
+            bounds.minY = std::min(bounds.minY, mEdges.minY[i]);
+            bounds.maxY = std::max(bounds.maxY, mEdges.maxY[i]);
+        }
+        mFacets.set(f, bounds);
+    }
+}
+
+size_t EdgeBounds::getCapacityBytes() const
+{
+    return mEdges.getCapacityBytes() + mFacets.getCapacityBytes();
+}
+
+EdgeBounds::Bounds EdgeBounds::getEdgeBounds(uint32_t edge, float yMargin) const
+{
+    return mEdges.get(edge, yMargin);
+}
+
+EdgeBounds::Bounds EdgeBounds::getFacetBounds(uint32_t facet, float yMargin) const
+{
+    return mFacets.get(facet, yMargin);
+}
+
+uint32_t EdgeBounds::markOverlappingEdges(uint32_t firstEdge, uint32_t edgeCount, const Bounds& bounds,
+                                          uint8_t* overlap) const
+{
+    return markOverlapping(mEdges, firstEdge, edgeCount, bounds, overlap);
+}
+
+uint32_t EdgeBounds::markOverlappingFacets(uint32_t firstFacet, uint32_t facetCount, const Bounds& bounds,
+                                           uint8_t* overlap) const
+{
+    return markOverlapping(mFacets, firstFacet, facetCount, bounds, overlap);
+}
+
+uint32_t EdgeBounds::markOverlapping(const BoundsArrays& arrays, uint32_t first, uint32_t count, const Bounds& bounds,
+                                     uint8_t* overlap) const
+{
+    static const MarkOverlappingKernel markOverlappingKernel = selectMarkOverlappingKernel();
+    const BoundsPointers boxes = { arrays.minX.data(), arrays.maxX.data(), arrays.minY.data(), arrays.maxY.data() };
+    const float query[4]       = { bounds.minX, bounds.maxX, bounds.minY, bounds.maxY };
+    return markOverlappingKernel(boxes, first, count, query, overlap);
+}
+
+}  // namespace Blast
+}  // namespace Nv
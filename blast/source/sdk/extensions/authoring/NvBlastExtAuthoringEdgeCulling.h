@@ -0,0 +1,116 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#ifndef NVBLASTEXTAUTHORINGEDGECULLING_H
+#define NVBLASTEXTAUTHORINGEDGECULLING_H
+
+#include "NvBlastExtAuthoringTypes.h"
+#include <vector>
+#include <stddef.h>
+
+namespace Nv
+{
+namespace Blast
+{
+
+class Mesh;
+
+/**
+    XY bounds of mesh edges and facets, used by BooleanEvaluator to skip edge-facet intersection tests which can't
+    give non-zero status. Edge and facet bounds are stored in SoA layout, so a range of edges or facets is tested
+    against one box 4 or 8 at a time. BooleanEvaluator batches the tests across facets: edges of all candidate facets
+    against the bounds of one facet of the other mesh, and bounds of all candidate facets against each edge of it.
+    SIMD kernel (SSE or AVX) is picked at runtime on first use, scalar kernel is used on other platforms.
+*/
+class EdgeBounds
+{
+public:
+    struct Bounds
+    {
+        float minX, maxX, minY, maxY;
+    };
+
+    /**
+        Compute bounds of all edges and facets of mesh.
+    */
+    void                build(const Mesh* mesh);
+
+    /**
+        Largest absolute Y coordinate of mesh vertices.
+    */
+    float               getMaxAbsY() const { return mMaxAbsY; }
+
+    /**
+        Bounds of edge or facet with Y range expanded by yMargin: vertex-facet and edge-edge tests compare Y of
+        interpolated points, which may be off by a few ulps. X ranges are compared exactly.
+    */
+    Bounds              getEdgeBounds(uint32_t edge, float yMargin) const;
+    Bounds              getFacetBounds(uint32_t facet, float yMargin) const;
+
+    /**
+        Memory reserved by bounds buffers.
+    */
+    size_t              getCapacityBytes() const;
+
+    /**
+        Test edges [firstEdge, firstEdge + edgeCount) against bounds of a facet of other mesh.
+        If edge range doesn't overlap facet range, edgeFacetIntersection12/21 returns 0 for it.
+        \param[in]  firstEdge   First edge to test
+        \param[in]  edgeCount   Number of edges to test
+        \param[in]  bounds      Facet bounds of other mesh, see getFacetBounds(...)
+        \param[out] overlap     For each edge 1 if it has to be tested, 0 otherwise
+        \return                 Number of edges to test
+    */
+    uint32_t            markOverlappingEdges(uint32_t firstEdge, uint32_t edgeCount, const Bounds& bounds,
+                                             uint8_t* overlap) const;
+
+    /**
+        Test facets [firstFacet, firstFacet + facetCount) against bounds of an edge of other mesh. Facet overlaps
+        edge exactly when edge overlaps facet, so it's the same test as markOverlappingEdges(...) done the other way.
+        \param[in]  firstFacet  First facet to test
+        \param[in]  facetCount  Number of facets to test
+        \param[in]  bounds      Edge bounds of other mesh, see getEdgeBounds(...)
+        \param[out] overlap     For each facet 1 if the edge has to be tested against it, 0 otherwise
+        \return                 Number of facets to test
+    */
+    uint32_t            markOverlappingFacets(uint32_t firstFacet, uint32_t facetCount, const Bounds& bounds,
+                                              uint8_t* overlap) const;
+
+private:
+    struct BoundsArrays
+    {
+        std::vector<float>  minX;
+        std::vector<float>  maxX;
+        std::vector<float>  minY;
+        std::vector<float>  maxY;
+
+        void    resize(uint32_t count);
+        void    set(uint32_t index, const Bounds& bounds);
+        Bounds  get(uint32_t index, float yMargin) const;
+        size_t  getCapacityBytes() const;
+    };
+
+    uint32_t            markOverlapping(const BoundsArrays& arrays, uint32_t first, uint32_t count, const Bounds& bounds,
+                                        uint8_t* overlap) const;
+
+    BoundsArrays                mEdges;
+    BoundsArrays                mFacets;
+    float                       mMaxAbsY;
+};
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGEDGECULLING_H
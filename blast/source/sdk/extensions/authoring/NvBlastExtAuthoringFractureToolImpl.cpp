@@ -33,10 +33,11 @@
 #if NV_VC && NV_VC < 14
 #pragma warning(disable : 4702)
 #endif
+#include <algorithm>
 #include <queue>
 #include <vector>
 #include <map>
-#include <stack>
+#include <set>
 #include <functional>
 #include "NvBlastExtAuthoringVSA.h"
 #include <float.h>
@@ -44,10 +45,16 @@
 #include "NvBlastExtAuthoringTriangulator.h"
 #include "NvBlastExtAuthoringBooleanToolImpl.h"
 #include "NvBlastExtAuthoringAcceleratorImpl.h"
+#include "NvBlastExtAuthoringBvhAccelerator.h"
 #include "NvBlastExtAuthoringCutout.h"
 #include "NvBlast.h"
 #include "NvBlastGlobals.h"
 #include "NvBlastExtAuthoringPerlinNoise.h"
+#include "NvBlastExtAuthoringParallel.h"
+#include "NvBlastExtAuthoringConvexCell.h"
+#include "NvBlastExtAuthoringMeshClipper.h"
+#include "NvBlastExtAuthoringNoiseSurface.h"
+#include "NvBlastExtAuthoringPointClassifier.h"
 #include <NvBlastAssert.h>
 #include <NvBlastNvSharedHelpers.h>
 
@@ -106,7 +113,8 @@ struct Halfspace_partitioning : public VSA::VS3D_Halfspace_Set
 };
 
 
-int32_t findCellBasePlanes(const std::vector<NvcVec3>& sites, std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors)
+static int32_t findCellBasePlanesHalfspaceTest(const std::vector<NvcVec3>& sites,
+                                               std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors)
 {
     Halfspace_partitioning prt;
     std::vector<NvcPlane>& planes = prt.planes;
@@ -150,33 +158,245 @@ int32_t findCellBasePlanes(const std::vector<NvcVec3>& sites, std::vector<std::v
 
 
 #define SITE_BOX_SIZE 4
-#define CUTTING_BOX_SIZE 40
 
-Mesh* getCellMesh(BooleanEvaluator& eval, int32_t planeIndexerOffset, int32_t cellId, const std::vector<NvcVec3>& sites,
-                  const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors, int32_t interiorMaterialId, NvcVec3 origin)
+/**
+    Uniform grid over voronoi sites, used to collect sites in a spherical shell around given point.
+*/
+class SiteGrid
+{
+public:
+    SiteGrid(const std::vector<NvcVec3>& sites) : mSites(sites)
+    {
+        NvcVec3 minimum = sites[0];
+        NvcVec3 maximum = sites[0];
+        for (const NvcVec3& s : sites)
+        {
+            minimum = { std::min(minimum.x, s.x), std::min(minimum.y, s.y), std::min(minimum.z, s.z) };
+            maximum = { std::max(maximum.x, s.x), std::max(maximum.y, s.y), std::max(maximum.z, s.z) };
+        }
+        mMinimum = minimum;
+
+        // Flat or degenerate site sets still get a valid cell size
+        const NvcVec3 extent = maximum - minimum;
+        mDiagonal            = sqrtf(extent | extent);
+        const float thinExtent = std::max(mDiagonal * 1e-3f, 1e-6f);
+        const float volume = std::max(extent.x, thinExtent) * std::max(extent.y, thinExtent) * std::max(extent.z, thinExtent);
+        mCellSize          = std::max(powf(2.0f * volume / sites.size(), 1.0f / 3.0f), thinExtent);
+        mResolution[0]     = std::min(static_cast<uint32_t>(extent.x / mCellSize) + 1, 1024u);
+        mResolution[1]     = std::min(static_cast<uint32_t>(extent.y / mCellSize) + 1, 1024u);
+        mResolution[2]     = std::min(static_cast<uint32_t>(extent.z / mCellSize) + 1, 1024u);
+
+        // Counting sort of sites by grid cell
+        mCellStart.assign(mResolution[0] * mResolution[1] * mResolution[2] + 1, 0);
+        std::vector<uint32_t> siteCell(sites.size());
+        for (uint32_t i = 0; i < sites.size(); ++i)
+        {
+            siteCell[i] = getCellIndex(getCoord(sites[i].x, 0), getCoord(sites[i].y, 1), getCoord(sites[i].z, 2));
+            ++mCellStart[siteCell[i] + 1];
+        }
+        for (uint32_t c = 1; c < mCellStart.size(); ++c)
+        {
+            mCellStart[c] += mCellStart[c - 1];
+        }
+        mCellSites.resize(sites.size());
+        std::vector<uint32_t> fill(mCellStart.begin(), mCellStart.end() - 1);
+        for (uint32_t i = 0; i < sites.size(); ++i)
+        {
+            mCellSites[fill[siteCell[i]]++] = i;
+        }
+    }
+
+    float getCellSize() const { return mCellSize; }
+    float getDiagonal() const { return mDiagonal; }
+
+    /**
+        Collects sites with minSqDistance < squared distance <= maxSqDistance to the point, sorted by distance then by index.
+    */
+    void query(const NvcVec3& point, uint32_t exclude, double minSqDistance, double maxSqDistance,
+               std::vector<std::pair<double, uint32_t>>& result) const
+    {
+        result.clear();
+        const float radius = static_cast<float>(sqrt(maxSqDistance));
+        const uint32_t x0 = getCoord(point.x - radius, 0), x1 = getCoord(point.x + radius, 0);
+        const uint32_t y0 = getCoord(point.y - radius, 1), y1 = getCoord(point.y + radius, 1);
+        const uint32_t z0 = getCoord(point.z - radius, 2), z1 = getCoord(point.z + radius, 2);
+        for (uint32_t z = z0; z <= z1; ++z)
+        {
+            for (uint32_t y = y0; y <= y1; ++y)
+            {
+                for (uint32_t x = x0; x <= x1; ++x)
+                {
+                    const uint32_t cell = getCellIndex(x, y, z);
+                    for (uint32_t k = mCellStart[cell]; k < mCellStart[cell + 1]; ++k)
+                    {
+                        const uint32_t s = mCellSites[k];
+                        const double dx  = (double)mSites[s].x - point.x;
+                        const double dy  = (double)mSites[s].y - point.y;
+                        const double dz  = (double)mSites[s].z - point.z;
+                        const double d2  = dx * dx + dy * dy + dz * dz;
+                        if (s != exclude && d2 > minSqDistance && d2 <= maxSqDistance)
+                        {
+                            result.push_back(std::make_pair(d2, s));
+                        }
+                    }
+                }
+            }
+        }
+        std::sort(result.begin(), result.end());
+    }
+
+private:
+    uint32_t getCoord(float value, uint32_t axis) const
+    {
+        const float minimum = axis == 0 ? mMinimum.x : (axis == 1 ? mMinimum.y : mMinimum.z);
+        const float c       = (value - minimum) / mCellSize;
+        if (c <= 0.0f)
+        {
+            return 0;
+        }
+        return std::min(static_cast<uint32_t>(std::min(c, 1e6f)), mResolution[axis] - 1);
+    }
+    uint32_t getCellIndex(uint32_t x, uint32_t y, uint32_t z) const
+    {
+        return (z * mResolution[1] + y) * mResolution[0] + x;
+    }
+
+    const std::vector<NvcVec3>& mSites;
+    NvcVec3                     mMinimum;
+    float                       mDiagonal;
+    float                       mCellSize;
+    uint32_t                    mResolution[3];
+    std::vector<uint32_t>       mCellStart;
+    std::vector<uint32_t>       mCellSites;
+};
+
+/**
+    Builds each cell as convex polytope clipped by bisectors of nearest sites first. Once all sites closer than
+    twice the distance to the farthest cell vertex are processed, the remaining ones can not cut the cell.
+    Cells are bounded with a box around the site, so only neighbors sharing a face within
+    max(SITE_BOX_SIZE * siteScale, sites bounds diagonal) of the site are reported.
+*/
+static int32_t findCellBasePlanesSecurityRadius(const std::vector<NvcVec3>& sites,
+                                                std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors,
+                                                uint32_t threadCount, float siteScale)
+{
+    neighbors.resize(sites.size());
+    if (sites.size() < 2)
+    {
+        return 0;
+    }
+
+    const SiteGrid grid(sites);
+    const float halfSize       = std::max(grid.getDiagonal(), SITE_BOX_SIZE * siteScale);
+    const double initialRadius = 2.0 * grid.getCellSize();
+
+    struct NeighborWorker
+    {
+        ConvexCell cell;
+        std::vector<std::pair<double, uint32_t>> candidates;
+    };
+    const uint32_t siteCount   = static_cast<uint32_t>(sites.size());
+    const uint32_t workerCount = getParallelWorkerCount(threadCount, siteCount);
+    std::vector<NeighborWorker> workers(workerCount);
+    std::vector<std::vector<uint32_t>> cellFaces(siteCount);
+
+    parallelFor(workerCount, siteCount, [&](uint32_t workerIndex, uint32_t i)
+    {
+        NeighborWorker& worker = workers[workerIndex];
+        const NvcVec3& site    = sites[i];
+        worker.cell.init({ site.x - halfSize, site.y - halfSize, site.z - halfSize },
+                         { site.x + halfSize, site.y + halfSize, site.z + halfSize });
+
+        double processedSq = -1.0;
+        double radius      = initialRadius;
+        for (;;)
+        {
+            grid.query(site, i, processedSq, radius * radius, worker.candidates);
+            for (const auto& candidate : worker.candidates)
+            {
+                worker.cell.clipBisector(site, sites[candidate.second], static_cast<int32_t>(candidate.second), 0);
+            }
+            processedSq = radius * radius;
+
+            const double securityRadius = 2.0 * sqrt(worker.cell.getMaxSquaredDistance(site));
+            if (worker.cell.isEmpty() || securityRadius <= radius)
+            {
+                break;
+            }
+            radius = securityRadius * (1.0 + 1e-6);
+        }
+
+        for (uint32_t f = 0; f < worker.cell.getFaceCount(); ++f)
+        {
+            const int32_t tag = worker.cell.getFaceTag(f);
+            if (tag != ConvexCell::BoxFaceTag)
+            {
+                cellFaces[i].push_back(static_cast<uint32_t>(tag));
+            }
+        }
+    });
+
+    // Make neighborhood symmetric and index pairs in the same order as half-space test does
+    std::vector<std::vector<uint32_t>> higherNeighbors(siteCount);
+    for (uint32_t i = 0; i < siteCount; ++i)
+    {
+        for (uint32_t j : cellFaces[i])
+        {
+            higherNeighbors[std::min(i, j)].push_back(std::max(i, j));
+        }
+    }
+    int32_t neighborGlobalIndex = 0;
+    for (uint32_t i = 0; i < siteCount; ++i)
+    {
+        std::vector<uint32_t>& list = higherNeighbors[i];
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+        for (uint32_t j : list)
+        {
+            neighbors[i].push_back(std::pair<int32_t, int32_t>(j, neighborGlobalIndex));
+            neighbors[j].push_back(std::pair<int32_t, int32_t>(i, neighborGlobalIndex));
+            ++neighborGlobalIndex;
+        }
+    }
+    return neighborGlobalIndex;
+}
+
+int32_t findCellBasePlanes(const std::vector<NvcVec3>& sites, std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors,
+                           VoronoiNeighborSearch::Enum method, uint32_t threadCount, float siteScale)
+{
+    if (method == VoronoiNeighborSearch::SECURITY_RADIUS)
+    {
+        return findCellBasePlanesSecurityRadius(sites, neighbors, threadCount, siteScale);
+    }
+    return findCellBasePlanesHalfspaceTest(sites, neighbors);
+}
+
+
+bool buildCell(ConvexCell& cell, int32_t planeIndexerOffset, int32_t cellId, const std::vector<NvcVec3>& sites,
+               const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors, NvcVec3 origin)
 {
-    Mesh* cell        = getBigBox(toNvShared(origin), SITE_BOX_SIZE, interiorMaterialId);
-    Mesh* cuttingMesh = getCuttingBox(NvVec3(0, 0, 0), NvVec3(1, 1, 1), CUTTING_BOX_SIZE, 0, interiorMaterialId);
+    cell.init({ origin.x - SITE_BOX_SIZE, origin.y - SITE_BOX_SIZE, origin.z - SITE_BOX_SIZE },
+              { origin.x + SITE_BOX_SIZE, origin.y + SITE_BOX_SIZE, origin.z + SITE_BOX_SIZE });
 
     for (uint32_t i = 0; i < neighbors[cellId].size(); ++i)
     {
         std::pair<int32_t, int32_t> neighbor = neighbors[cellId][i];
-        int32_t nCell    = neighbor.first;
-        NvVec3 midpoint  = 0.5 * toNvShared(sites[nCell] + sites[cellId]);
-        NvVec3 direction = toNvShared(sites[nCell] - sites[cellId]).getNormalized();
+        int32_t nCell      = neighbor.first;
         int32_t planeIndex = neighbor.second + planeIndexerOffset;
         if (nCell < cellId)
             planeIndex = -planeIndex;
-        setCuttingBox(midpoint, -direction, cuttingMesh, CUTTING_BOX_SIZE, planeIndex);
-        eval.performFastCutting(cell, cuttingMesh, BooleanConfigurations::BOOLEAN_INTERSECTION());
-        Mesh* newCell = eval.createNewMesh();
-        delete cell;
-        cell = newCell;
-        if (cell == nullptr)
-            break;
+        if (!cell.clipBisector(sites[cellId], sites[nCell], nCell, planeIndex))
+            return false;
     }
-    delete cuttingMesh;
-    return cell;
+    return true;
+}
+
+Mesh* getCellMesh(ConvexCell& cell, int32_t planeIndexerOffset, int32_t cellId, const std::vector<NvcVec3>& sites,
+                  const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors, int32_t interiorMaterialId, NvcVec3 origin)
+{
+    if (!buildCell(cell, planeIndexerOffset, cellId, sites, neighbors, origin))
+        return nullptr;
+    return cell.createMesh(interiorMaterialId);
 }
 
 
@@ -186,22 +406,33 @@ VoronoiSitesGeneratorImpl::VoronoiSitesGeneratorImpl(const Mesh* mesh, RandomGen
 {
     mMesh        = mesh;
     mRnd         = rnd;
-    mAccelerator = new BBoxBasedAccelerator(mMesh, kBBoxBasedAcceleratorDefaultResolution);
+    mClassifier  = new PointInMeshClassifier(mMesh);
     mStencil     = nullptr;
+    mStencilClassifier = nullptr;
+    mOccupancy   = nullptr;
+    mNeighborSearch = VoronoiNeighborSearch::HALFSPACE_TEST;
+    mNeighborsValid = false;
+    mNeighborSitesSearch = VoronoiNeighborSearch::HALFSPACE_TEST;
+    mNeighborSiteScale   = 1.0f;
+    mNeighborCount  = 0;
 }
 
 void VoronoiSitesGeneratorImpl::setBaseMesh(const Mesh* m)
 {
     mGeneratedSites.clear();
-    delete mAccelerator;
+    delete mClassifier;
     mMesh        = m;
-    mAccelerator = new BBoxBasedAccelerator(mMesh, kBBoxBasedAcceleratorDefaultResolution);
+    mClassifier  = new PointInMeshClassifier(mMesh);
+    SAFE_DELETE(mOccupancy);
 }
 
 VoronoiSitesGeneratorImpl::~VoronoiSitesGeneratorImpl()
 {
-    delete mAccelerator;
-    mAccelerator = nullptr;
+    delete mClassifier;
+    mClassifier = nullptr;
+    delete mStencilClassifier;
+    mStencilClassifier = nullptr;
+    SAFE_DELETE(mOccupancy);
 }
 
 void VoronoiSitesGeneratorImpl::release()
@@ -212,33 +443,72 @@ void VoronoiSitesGeneratorImpl::release()
 void VoronoiSitesGeneratorImpl::setStencil(const Mesh* stencil)
 {
     mStencil = stencil;
+    delete mStencilClassifier;
+    mStencilClassifier = stencil != nullptr ? new PointInMeshClassifier(stencil) : nullptr;
+    SAFE_DELETE(mOccupancy);
 }
 
 
 void VoronoiSitesGeneratorImpl::clearStencil()
 {
     mStencil = nullptr;
+    delete mStencilClassifier;
+    mStencilClassifier = nullptr;
+    SAFE_DELETE(mOccupancy);
+}
+
+const OccupancyGrid& VoronoiSitesGeneratorImpl::getOccupancyGrid()
+{
+    if (mOccupancy == nullptr)
+    {
+        mOccupancy = new OccupancyGrid(mMesh, *mClassifier, mStencil, mStencilClassifier);
+    }
+    return *mOccupancy;
+}
+
+bool VoronoiSitesGeneratorImpl::isPointInside(const NvcVec3& point)
+{
+    switch (getOccupancyGrid().getState(point))
+    {
+    case OccupancyGrid::INSIDE:
+        return true;
+    case OccupancyGrid::OUTSIDE:
+        return false;
+    default:
+        return mClassifier->classify(point) && (mStencilClassifier == nullptr || mStencilClassifier->classify(point));
+    }
 }
 
 
 void VoronoiSitesGeneratorImpl::uniformlyGenerateSitesInMesh(const uint32_t sitesCount)
 {
-    BooleanEvaluator voronoiMeshEval;
-    NvcVec3 mn              = mMesh->getBoundingBox().minimum;
-    NvcVec3 mx              = mMesh->getBoundingBox().maximum;
-    NvcVec3 vc              = mx - mn;
+    /**
+        Draw voxel among occupied ones, then point in it. Points in inside voxels are accepted without tests,
+        only points in boundary voxels can be rejected.
+    */
+    const OccupancyGrid& grid    = getOccupancyGrid();
+    const uint32_t occupiedCount = grid.getOccupiedCount();
+    if (occupiedCount == 0)
+    {
+        return;
+    }
     uint32_t attemptNumber  = 0;
     uint32_t generatedSites = 0;
     while (generatedSites < sitesCount && attemptNumber < MAX_VORONOI_ATTEMPT_NUMBER)
     {
+        const uint32_t voxel = std::min(static_cast<uint32_t>(mRnd->getRandomValue() * occupiedCount), occupiedCount - 1);
+        NvcBounds3 bounds;
+        const OccupancyGrid::State state = grid.getOccupiedVoxel(voxel, bounds);
+        const NvcVec3 vc = bounds.maximum - bounds.minimum;
         float rn1 = mRnd->getRandomValue() * vc.x;
         float rn2 = mRnd->getRandomValue() * vc.y;
         float rn3 = mRnd->getRandomValue() * vc.z;
-        if (voronoiMeshEval.isPointContainedInMesh(mMesh, NvcVec3{ rn1, rn2, rn3 } + mn) &&
-            (mStencil == nullptr || voronoiMeshEval.isPointContainedInMesh(mStencil, NvcVec3{ rn1, rn2, rn3 } + mn)))
+        const NvcVec3 point = NvcVec3{ rn1, rn2, rn3 } + bounds.minimum;
+        if (state == OccupancyGrid::INSIDE ||
+            (mClassifier->classify(point) && (mStencilClassifier == nullptr || mStencilClassifier->classify(point))))
         {
             generatedSites++;
-            mGeneratedSites.push_back(NvcVec3{ rn1, rn2, rn3 } + mn);
+            mGeneratedSites.push_back(point);
             attemptNumber = 0;
         }
         else
@@ -254,7 +524,6 @@ void VoronoiSitesGeneratorImpl::uniformlyGenerateSitesInMesh(const uint32_t site
 void VoronoiSitesGeneratorImpl::clusteredSitesGeneration(const uint32_t numberOfClusters,
                                                          const uint32_t sitesPerCluster, float clusterRadius)
 {
-    BooleanEvaluator voronoiMeshEval;
     NvcVec3 mn              = mMesh->getBoundingBox().minimum;
     NvcVec3 mx              = mMesh->getBoundingBox().maximum;
     NvcVec3 middle          = (mx + mn) * 0.5;
@@ -269,8 +538,7 @@ void VoronoiSitesGeneratorImpl::clusteredSitesGeneration(const uint32_t numberOf
         float rn3 = mRnd->getRandomValue() * 2 - 1;
         NvcVec3 p = { middle.x + rn1 * vc.x, middle.y + rn2 * vc.y, middle.z + rn3 * vc.z };
 
-        if (voronoiMeshEval.isPointContainedInMesh(mMesh, p) &&
-            (mStencil == nullptr || voronoiMeshEval.isPointContainedInMesh(mStencil, p)))
+        if (isPointInside(p))
         {
             generatedSites++;
             tempPoints.push_back(p);
@@ -295,8 +563,7 @@ void VoronoiSitesGeneratorImpl::clusteredSitesGeneration(const uint32_t numberOf
                                                      mRnd->getRandomValue() * 2 - 1)
                                                   .getNormalized()) *
                                         (mRnd->getRandomValue() + 0.001f) * clusterRadius;
-            if (voronoiMeshEval.isPointContainedInMesh(mMesh, p) &&
-                (mStencil == nullptr || voronoiMeshEval.isPointContainedInMesh(mStencil, p)))
+            if (isPointInside(p))
             {
                 totalCount++;
                 generatedSites++;
@@ -324,7 +591,6 @@ void VoronoiSitesGeneratorImpl::addSite(const NvcVec3& site)
 
 void VoronoiSitesGeneratorImpl::generateInSphere(const uint32_t count, const float radius, const NvcVec3& center)
 {
-    BooleanEvaluator voronoiMeshEval;
     uint32_t attemptNumber  = 0;
     uint32_t generatedSites = 0;
     std::vector<NvcVec3> tempPoints;
@@ -337,8 +603,7 @@ void VoronoiSitesGeneratorImpl::generateInSphere(const uint32_t count, const flo
         float rn3     = (mRnd->getRandomValue() - 0.5f) * 2.f * radius;
         NvcVec3 point = { rn1, rn2, rn3 };
         if (toNvShared(point).magnitudeSquared() < radiusSquared &&
-            voronoiMeshEval.isPointContainedInMesh(mMesh, point + center) &&
-            (mStencil == nullptr || voronoiMeshEval.isPointContainedInMesh(mStencil, point + center)))
+            isPointInside(point + center))
         {
             generatedSites++;
             mGeneratedSites.push_back(point + center);
@@ -370,7 +635,6 @@ void VoronoiSitesGeneratorImpl::deleteInSphere(const float radius, const NvcVec3
 
 void VoronoiSitesGeneratorImpl::blastPattern(BlastConfiguration conf)
 {
-    BooleanEvaluator voronoiMeshEval;
     uint32_t attemptNumber = 0;
     uint32_t generatedSites = 0;
     NvcVec3 mn = mMesh->getBoundingBox().minimum;
@@ -414,8 +678,7 @@ void VoronoiSitesGeneratorImpl::blastPattern(BlastConfiguration conf)
         NvcVec3 point = rn1 * t1c + rn2 * t2c + rn3 * conf.blastNormal;
 
         if (toNvShared(point).magnitudeSquared() < currentRadiusSquared &&
-            voronoiMeshEval.isPointContainedInMesh(mMesh, point + conf.blastPoint) &&
-            (mStencil == nullptr || voronoiMeshEval.isPointContainedInMesh(mStencil, point + conf.blastPoint)))
+            isPointInside(point + conf.blastPoint))
         {
             generatedSites++;
             mGeneratedSites.push_back(point + point + conf.blastPoint);
@@ -445,8 +708,7 @@ void VoronoiSitesGeneratorImpl::blastPattern(BlastConfiguration conf)
         NvcVec3 point = rn1 * t1c + rn2 * t2c + rn3 * conf.blastNormal;
 
         if (toNvShared(point).magnitudeSquared() < currentRadiusSquared &&
-            voronoiMeshEval.isPointContainedInMesh(mMesh, point + conf.blastPoint) &&
-            (mStencil == nullptr || voronoiMeshEval.isPointContainedInMesh(mStencil, point + conf.blastPoint)))
+            isPointInside(point + conf.blastPoint))
         {
             generatedSites++;
             mGeneratedSites.push_back(point + point + conf.blastPoint);
@@ -468,8 +730,7 @@ void VoronoiSitesGeneratorImpl::blastPattern(BlastConfiguration conf)
         float rn1 = mRnd->getRandomValue() * vc.x;
         float rn2 = mRnd->getRandomValue() * vc.y;
         float rn3 = mRnd->getRandomValue() * vc.z;
-        if (voronoiMeshEval.isPointContainedInMesh(mMesh, NvcVec3{ rn1, rn2, rn3 } + mn) &&
-            (mStencil == nullptr || voronoiMeshEval.isPointContainedInMesh(mStencil, NvcVec3{ rn1, rn2, rn3 } + mn)))
+        if (isPointInside(NvcVec3{ rn1, rn2, rn3 } + mn))
         {
             generatedSites++;
             mGeneratedSites.push_back(NvcVec3{ rn1, rn2, rn3 } + mn);
@@ -510,6 +771,66 @@ void VoronoiSitesGeneratorImpl::blastPattern(BlastConfiguration conf)
     return;
 }
 
+void VoronoiSitesGeneratorImpl::setNeighborSearch(VoronoiNeighborSearch::Enum method)
+{
+    mNeighborSearch = method;
+}
+
+VoronoiNeighborSearch::Enum VoronoiSitesGeneratorImpl::getNeighborSearch() const
+{
+    return mNeighborSearch;
+}
+
+void VoronoiSitesGeneratorImpl::updateNeighbors(uint32_t threadCount, float siteScale)
+{
+    // Sites are compared by value, so every way of changing them invalidates the cache. Site scale bounds only the
+    // security radius search.
+    const bool sameScale =
+        mNeighborSearch != VoronoiNeighborSearch::SECURITY_RADIUS || mNeighborSiteScale == siteScale;
+    if (mNeighborsValid && mNeighborSitesSearch == mNeighborSearch && sameScale &&
+        mNeighborSites.size() == mGeneratedSites.size() &&
+        std::equal(mNeighborSites.begin(), mNeighborSites.end(), mGeneratedSites.begin(),
+                   [](const NvcVec3& a, const NvcVec3& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }))
+    {
+        return;
+    }
+
+    mNeighborSites       = mGeneratedSites;
+    mNeighborSitesSearch = mNeighborSearch;
+    mNeighborSiteScale   = siteScale;
+    mNeighbors.clear();
+    mNeighborCount = findCellBasePlanes(mNeighborSites, mNeighbors, mNeighborSearch, threadCount, siteScale);
+
+    mNeighborOffsets.assign(1, 0);
+    mNeighborIndices.clear();
+    mNeighborIndices.reserve(mNeighborCount * 2);
+    for (const auto& cellNeighbors : mNeighbors)
+    {
+        for (const auto& neighbor : cellNeighbors)
+        {
+            mNeighborIndices.push_back(neighbor.first);
+        }
+        mNeighborOffsets.push_back(static_cast<int32_t>(mNeighborIndices.size()));
+    }
+    mNeighborsValid = true;
+}
+
+const std::vector<std::vector<std::pair<int32_t, int32_t>>>&
+VoronoiSitesGeneratorImpl::getNeighbors(int32_t& neighborCount, uint32_t threadCount, float siteScale)
+{
+    updateNeighbors(threadCount, siteScale);
+    neighborCount = mNeighborCount;
+    return mNeighbors;
+}
+
+int32_t VoronoiSitesGeneratorImpl::getNeighborsCSR(const int32_t*& offsets, const int32_t*& neighbors)
+{
+    updateNeighbors(1, 1.0f);
+    offsets   = mNeighborOffsets.data();
+    neighbors = mNeighborIndices.data();
+    return mNeighborCount;
+}
+
 
 void VoronoiSitesGeneratorImpl::radialPattern(const NvcVec3& center, const NvcVec3& normal, float radius,
                                               int32_t angularSteps, int32_t radialSteps, float angleOffset,
@@ -558,8 +879,143 @@ uint32_t VoronoiSitesGeneratorImpl::getVoronoiSites(const NvcVec3*& sites)
     return (uint32_t)mGeneratedSites.size();
 }
 
+void FractureToolImpl::buildVoronoiCells(const Mesh* mesh, const std::vector<NvcVec3>& cellPoints,
+                                         const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors,
+                                         const NvcVec3* scale, const NvcQuat* rotation, std::vector<Mesh*>& cellMeshes,
+                                         std::vector<std::vector<std::pair<Vertex, Vertex>>>* cellCrackEdges)
+{
+    std::vector<VoronoiChunkJob> jobs(1);
+    jobs[0].mesh               = mesh;
+    jobs[0].cellPoints         = &cellPoints;
+    jobs[0].neighbors          = &neighbors;
+    jobs[0].planeIndexerOffset = mPlaneIndexerOffset;
+    buildVoronoiCells(jobs, scale, rotation, cellCrackEdges != nullptr);
+
+    cellMeshes.swap(jobs[0].cellMeshes);
+    if (cellCrackEdges != nullptr)
+    {
+        cellCrackEdges->swap(jobs[0].cellCrackEdges);
+    }
+}
+
+void FractureToolImpl::buildVoronoiCells(std::vector<VoronoiChunkJob>& jobs, const NvcVec3* scale, const NvcQuat* rotation,
+                                         bool collectCrackEdges)
+{
+    /**
+    Work items are (job, cell) pairs in job order, so workers pulling consecutive items mostly stay on the same chunk
+    */
+    std::vector<std::pair<uint32_t, uint32_t>> items;
+    for (uint32_t j = 0; j < jobs.size(); ++j)
+    {
+        const uint32_t cellCount = static_cast<uint32_t>(jobs[j].cellPoints->size());
+        jobs[j].cellMeshes.assign(cellCount, nullptr);
+        jobs[j].cellCrackEdges.clear();
+        if (collectCrackEdges)
+        {
+            jobs[j].cellCrackEdges.resize(cellCount);
+        }
+        for (uint32_t i = 0; i < cellCount; ++i)
+        {
+            items.push_back(std::make_pair(j, i));
+        }
+    }
+
+    /**
+    Cell is convex, so chunk mesh is clipped by the planes of cell faces one by one instead of boolean intersection
+    with the cell mesh. Each worker owns its cell and clipper.
+    */
+    struct VoronoiWorker
+    {
+        ConvexCell              cell;
+        MeshClipper             clipper;
+    };
+    const uint32_t itemCount   = static_cast<uint32_t>(items.size());
+    const uint32_t workerCount = getParallelWorkerCount(mThreadCount, itemCount);
+    std::vector<VoronoiWorker> workers(workerCount);
+
+    const int32_t interiorMaterialId = mInteriorMaterialId;
+
+    parallelFor(workerCount, itemCount, [&](uint32_t w, uint32_t item)
+    {
+        VoronoiWorker& worker = workers[w];
+        VoronoiChunkJob& job  = jobs[items[item].first];
+        const uint32_t i      = items[item].second;
+        const std::vector<NvcVec3>& cellPoints = *job.cellPoints;
+        if (!buildCell(worker.cell, job.planeIndexerOffset, i, cellPoints, *job.neighbors, cellPoints[i]))
+        {
+            return;
+        }
+
+        worker.clipper.setMesh(job.mesh);
+        for (uint32_t f = 0; f < worker.cell.getFaceCount(); ++f)
+        {
+            ClipPlane plane;
+            worker.cell.getFacePlane(f, interiorMaterialId, plane);
+            if (scale != nullptr)
+            {
+                /**
+                Cell is scaled and rotated, p' = R(S p). Plane n.p + d becomes (R(S^-1 n)).p' + d, UV axes are
+                transformed the same way, so cap UVs stay those of the untransformed cell.
+                */
+                const NvVec3 invScale(1.0f / scale->x, 1.0f / scale->y, 1.0f / scale->z);
+                const NvVec3 n  = toNvShared(*rotation).rotate(NvVec3((float)plane.n[0], (float)plane.n[1], (float)plane.n[2]).multiply(invScale));
+                const NvVec3 u  = toNvShared(*rotation).rotate(NvVec3((float)plane.u[0], (float)plane.u[1], (float)plane.u[2]).multiply(invScale));
+                const NvVec3 v  = toNvShared(*rotation).rotate(NvVec3((float)plane.v[0], (float)plane.v[1], (float)plane.v[2]).multiply(invScale));
+                const double length = n.magnitude();
+                for (uint32_t k = 0; k < 3; ++k)
+                {
+                    plane.n[k] = n[k] / length;
+                    plane.u[k] = u[k];
+                    plane.v[k] = v[k];
+                }
+                plane.d /= length;
+            }
+            if (!worker.clipper.clip(plane))
+            {
+                return;
+            }
+        }
+        job.cellMeshes[i] = worker.clipper.createMesh();
+        if (job.cellMeshes[i] != nullptr && collectCrackEdges)
+        {
+            /* Unity Extensions */
+            worker.clipper.getCrackEdges(job.cellCrackEdges[i]);
+        }
+    });
+}
+
 int32_t
 FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const NvcVec3* cellPointsIn, bool replaceChunk)
+{
+    if (cellCount < 2)
+    {
+        return 1;
+    }
+
+    const int32_t chunkInfoIndex = getChunkInfoIndex(chunkId);
+    if (chunkInfoIndex == -1)
+    {
+        return 1;
+    }
+
+    /**
+    Neighbors are searched in chunk space, as in voronoiFracturingBatch, so the search box matches the box cells are
+    built in
+    */
+    const TransformST& tm = mChunkData[chunkInfoIndex].getTmToWorld();
+    std::vector<NvcVec3> cellPoints(cellCount);
+    for (uint32_t i = 0; i < cellCount; ++i)
+    {
+        cellPoints[i] = tm.invTransformPos(cellPointsIn[i]);
+    }
+    std::vector<std::vector<std::pair<int32_t, int32_t>>> neighbors;
+    const int32_t neighborCount = findCellBasePlanes(cellPoints, neighbors, mNeighborSearch, mThreadCount);
+    return voronoiFracturing(chunkId, cellCount, cellPointsIn, neighbors, neighborCount, replaceChunk);
+}
+
+int32_t FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const NvcVec3* cellPointsIn,
+                                            const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors,
+                                            int32_t neighborCount, bool replaceChunk)
 {
     if (chunkId == 0 && replaceChunk)
     {
@@ -567,7 +1023,7 @@ FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const
     }
 
     int32_t chunkInfoIndex = getChunkInfoIndex(chunkId);
-    if (chunkInfoIndex == -1 || cellCount < 2)
+    if (chunkInfoIndex == -1 || cellCount < 2 || neighbors.size() != cellCount)
     {
         return 1;
     }
@@ -588,15 +1044,154 @@ FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const
     }
 
     /**
-    Prebuild accelerator structure
+    Unity Extensions
     */
-    BooleanEvaluator eval;
-    BooleanEvaluator voronoiMeshEval;
+    mCrackEdges.clear();
+    mLastCrackIndex = 0;
 
-    BBoxBasedAccelerator spAccel = BBoxBasedAccelerator(mesh, kBBoxBasedAcceleratorDefaultResolution);
+    /**
+    Fracture
+    */
+    std::vector<Mesh*> cellMeshes;
+    std::vector<std::vector<std::pair<Vertex, Vertex>>> cellCrackEdges;
+    buildVoronoiCells(mesh, cellPoints, neighbors, nullptr, nullptr, cellMeshes, &cellCrackEdges);
 
-    std::vector<std::vector<std::pair<int32_t, int32_t>>> neighbors;
-    const int32_t neighborCount = findCellBasePlanes(cellPoints, neighbors);
+    /**
+    Commit cells in site order, so chunk IDs and crack edges don't depend on thread count
+    */
+    int32_t parentChunkId = replaceChunk ? mChunkData[chunkInfoIndex].parentChunkId : chunkId;
+    std::vector<uint32_t> newlyCreatedChunksIds;
+    for (uint32_t i = 0; i < cellPoints.size(); ++i)
+    {
+        if (cellMeshes[i] == nullptr)
+        {
+            continue;
+        }
+        /* Unity Extensions */
+        mCrackEdges.insert(mCrackEdges.end(), cellCrackEdges[i].begin(), cellCrackEdges[i].end());
+
+        uint32_t ncidx             = createNewChunk(parentChunkId);
+        mChunkData[ncidx].isLeaf   = true;
+        setChunkInfoMesh(mChunkData[ncidx], cellMeshes[i]);
+        newlyCreatedChunksIds.push_back(mChunkData[ncidx].chunkId);
+
+        mLastCrackIndex = mCrackEdges.size();
+    }
+    mChunkData[chunkInfoIndex].isLeaf = false;
+    if (replaceChunk)
+    {
+        deleteChunkSubhierarchy(chunkId, true);
+    }
+    mPlaneIndexerOffset += neighborCount;
+
+    if (mRemoveIslands)
+    {
+        for (auto chunkToCheck : newlyCreatedChunksIds)
+        {
+            islandDetectionAndRemoving(chunkToCheck);
+        }
+    }
+
+    return 0;
+}
+
+int32_t FractureToolImpl::voronoiFracturingBatch(uint32_t chunkCount, const uint32_t* chunkIds, const uint32_t* cellCounts,
+                                                 const NvcVec3* cellPoints, bool replaceChunk)
+{
+    int32_t result = 0;
+
+    /**
+    Validate input, skipped chunks still consume their sites
+    */
+    std::vector<uint32_t> batchChunkIds;
+    std::vector<const NvcVec3*> batchSites;
+    std::vector<uint32_t> batchCellCounts;
+    std::set<uint32_t> usedChunkIds;
+    const NvcVec3* sites = cellPoints;
+    for (uint32_t c = 0; c < chunkCount; ++c)
+    {
+        const uint32_t chunkId   = chunkIds[c];
+        const uint32_t cellCount = cellCounts[c];
+        const NvcVec3* chunkSites = sites;
+        sites += cellCount;
+        if ((chunkId == 0 && replaceChunk) || cellCount < 2 || getChunkInfoIndex(chunkId) == -1 ||
+            !usedChunkIds.insert(chunkId).second)
+        {
+            result = 1;
+            continue;
+        }
+        batchChunkIds.push_back(chunkId);
+        batchSites.push_back(chunkSites);
+        batchCellCounts.push_back(cellCount);
+    }
+
+    /**
+    Remove previous fracturing first, it can remove other chunks of the batch if they are its descendants
+    */
+    for (uint32_t chunkId : batchChunkIds)
+    {
+        const int32_t chunkInfoIndex = getChunkInfoIndex(chunkId);
+        if (chunkInfoIndex != -1 && !mChunkData[chunkInfoIndex].isLeaf)
+        {
+            deleteChunkSubhierarchy(chunkId);
+        }
+    }
+
+    /**
+    Sites are transformed to chunk space, jobs point to per chunk storage which is not resized afterwards
+    */
+    const uint32_t batchCount = static_cast<uint32_t>(batchChunkIds.size());
+    std::vector<std::vector<NvcVec3>> chunkCellPoints(batchCount);
+    std::vector<std::vector<std::vector<std::pair<int32_t, int32_t>>>> chunkNeighbors(batchCount);
+    std::vector<int32_t> chunkNeighborCounts(batchCount, 0);
+    std::vector<uint32_t> jobChunkIds;
+    std::vector<VoronoiChunkJob> jobs;
+    jobs.reserve(batchCount);
+    for (uint32_t b = 0; b < batchCount; ++b)
+    {
+        const int32_t chunkInfoIndex = getChunkInfoIndex(batchChunkIds[b]);
+        if (chunkInfoIndex == -1)
+        {
+            result = 1;
+            continue;
+        }
+        const TransformST& tm = mChunkData[chunkInfoIndex].getTmToWorld();
+        std::vector<NvcVec3>& points = chunkCellPoints[jobs.size()];
+        points.resize(batchCellCounts[b]);
+        for (uint32_t i = 0; i < batchCellCounts[b]; ++i)
+        {
+            points[i] = tm.invTransformPos(batchSites[b][i]);
+        }
+
+        VoronoiChunkJob job;
+        job.mesh               = mChunkData[chunkInfoIndex].getMesh();
+        job.cellPoints         = &points;
+        job.neighbors          = &chunkNeighbors[jobs.size()];
+        job.planeIndexerOffset = 0;
+        jobs.push_back(job);
+        jobChunkIds.push_back(batchChunkIds[b]);
+    }
+    const uint32_t jobCount = static_cast<uint32_t>(jobs.size());
+
+    /**
+    Neighbor search runs over chunks concurrently, single chunk gets all threads instead
+    */
+    const uint32_t chunkWorkerCount = getParallelWorkerCount(mThreadCount, jobCount);
+    const uint32_t searchThreadCount = chunkWorkerCount > 1 ? 1 : mThreadCount;
+    parallelFor(chunkWorkerCount, jobCount, [&](uint32_t, uint32_t j)
+    {
+        chunkNeighborCounts[j] = findCellBasePlanes(chunkCellPoints[j], chunkNeighbors[j], mNeighborSearch, searchThreadCount);
+    });
+
+    /**
+    Plane indices are reserved in chunk order, as if chunks were fractured one by one
+    */
+    int64_t planeIndexerOffset = mPlaneIndexerOffset;
+    for (uint32_t j = 0; j < jobCount; ++j)
+    {
+        jobs[j].planeIndexerOffset = planeIndexerOffset;
+        planeIndexerOffset += chunkNeighborCounts[j];
+    }
 
     /**
     Unity Extensions
@@ -604,44 +1199,40 @@ FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const
     mCrackEdges.clear();
     mLastCrackIndex = 0;
 
+    buildVoronoiCells(jobs, nullptr, nullptr, true);
+
     /**
-    Fracture
+    Commit cells in chunk and site order
     */
-    int32_t parentChunkId = replaceChunk ? mChunkData[chunkInfoIndex].parentChunkId : chunkId;
     std::vector<uint32_t> newlyCreatedChunksIds;
-    for (uint32_t i = 0; i < cellPoints.size(); ++i)
+    for (uint32_t j = 0; j < jobCount; ++j)
     {
-        Mesh* cell =
-            getCellMesh(eval, mPlaneIndexerOffset, i, cellPoints, neighbors, mInteriorMaterialId, cellPoints[i]);
-
-        if (cell == nullptr)
-        {
-            continue;
-        }
-        DummyAccelerator dmAccel(cell->getFacetCount());
-        voronoiMeshEval.performBoolean(mesh, cell, &spAccel, &dmAccel, BooleanConfigurations::BOOLEAN_INTERSECTION());
-        Mesh* resultMesh = voronoiMeshEval.createNewMesh();
-        if (resultMesh)
+        const uint32_t chunkId       = jobChunkIds[j];
+        const int32_t chunkInfoIndex = getChunkInfoIndex(chunkId);
+        const int32_t parentChunkId  = replaceChunk ? mChunkData[chunkInfoIndex].parentChunkId : chunkId;
+        for (uint32_t i = 0; i < jobs[j].cellMeshes.size(); ++i)
         {
+            if (jobs[j].cellMeshes[i] == nullptr)
+            {
+                continue;
+            }
             /* Unity Extensions */
-            voronoiMeshEval.setCrackEdges(mCrackEdges);
+            mCrackEdges.insert(mCrackEdges.end(), jobs[j].cellCrackEdges[i].begin(), jobs[j].cellCrackEdges[i].end());
 
             uint32_t ncidx             = createNewChunk(parentChunkId);
             mChunkData[ncidx].isLeaf   = true;
-            setChunkInfoMesh(mChunkData[ncidx], resultMesh);
+            setChunkInfoMesh(mChunkData[ncidx], jobs[j].cellMeshes[i]);
             newlyCreatedChunksIds.push_back(mChunkData[ncidx].chunkId);
 
             mLastCrackIndex = mCrackEdges.size();
         }
-        eval.reset();
-        delete cell;
-    }
-    mChunkData[chunkInfoIndex].isLeaf = false;
-    if (replaceChunk)
-    {
-        deleteChunkSubhierarchy(chunkId, true);
+        mChunkData[chunkInfoIndex].isLeaf = false;
+        if (replaceChunk)
+        {
+            deleteChunkSubhierarchy(chunkId, true);
+        }
     }
-    mPlaneIndexerOffset += neighborCount;
+    mPlaneIndexerOffset = planeIndexerOffset;
 
     if (mRemoveIslands)
     {
@@ -651,7 +1242,7 @@ FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const
         }
     }
 
-    return 0;
+    return result;
 }
 
 template<typename Cmp>
@@ -885,53 +1476,28 @@ int32_t FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount
         cellPoints[i].z *= (1.0f / scale.z);
     }
 
-    /**
-    Prebuild accelerator structure
-    */
-    BooleanEvaluator eval;
-    BooleanEvaluator voronoiMeshEval;
-
-    BBoxBasedAccelerator spAccel = BBoxBasedAccelerator(mesh, kBBoxBasedAcceleratorDefaultResolution);
-
     std::vector<std::vector<std::pair<int32_t, int32_t>>> neighbors;
-    const int32_t neighborCount = findCellBasePlanes(cellPoints, neighbors);
+    const int32_t neighborCount = findCellBasePlanes(cellPoints, neighbors, mNeighborSearch, mThreadCount);
 
     /**
     Fracture
     */
+    std::vector<Mesh*> cellMeshes;
+    buildVoronoiCells(mesh, cellPoints, neighbors, &scale, &rotation, cellMeshes, nullptr);
+
     int32_t parentChunkId = replaceChunk ? mChunkData[chunkInfoIndex].parentChunkId : chunkId;
     std::vector<uint32_t> newlyCreatedChunksIds;
 
     for (uint32_t i = 0; i < cellPoints.size(); ++i)
     {
-        Mesh* cell =
-            getCellMesh(eval, mPlaneIndexerOffset, i, cellPoints, neighbors, mInteriorMaterialId, cellPoints[i]);
-
-        if (cell == nullptr)
+        if (cellMeshes[i] == nullptr)
         {
             continue;
         }
-
-        for (uint32_t v = 0; v < cell->getVerticesCount(); ++v)
-        {
-            cell->getVerticesWritable()[v].p.x *= scale.x;
-            cell->getVerticesWritable()[v].p.y *= scale.y;
-            cell->getVerticesWritable()[v].p.z *= scale.z;
-            toNvShared(cell->getVerticesWritable()[v].p) = toNvShared(rotation).rotate(toNvShared(cell->getVerticesWritable()[v].p));
-        }
-        cell->recalculateBoundingBox();
-        DummyAccelerator dmAccel(cell->getFacetCount());
-        voronoiMeshEval.performBoolean(mesh, cell, &spAccel, &dmAccel, BooleanConfigurations::BOOLEAN_INTERSECTION());
-        Mesh* resultMesh = voronoiMeshEval.createNewMesh();
-        if (resultMesh)
-        {
-            uint32_t ncidx             = createNewChunk(parentChunkId);
-            mChunkData[ncidx].isLeaf   = true;
-            setChunkInfoMesh(mChunkData[ncidx], resultMesh);
-            newlyCreatedChunksIds.push_back(mChunkData[ncidx].chunkId);
-        }
-        eval.reset();
-        delete cell;
+        uint32_t ncidx             = createNewChunk(parentChunkId);
+        mChunkData[ncidx].isLeaf   = true;
+        setChunkInfoMesh(mChunkData[ncidx], cellMeshes[i]);
+        newlyCreatedChunksIds.push_back(mChunkData[ncidx].chunkId);
     }
     mChunkData[chunkInfoIndex].isLeaf = false;
     if (replaceChunk)
@@ -951,6 +1517,140 @@ int32_t FractureToolImpl::voronoiFracturing(uint32_t chunkId, uint32_t cellCount
     return 0;
 }
 
+/**
+    Planes of one slicing stage along axis dir, starting at start with step offset. Random values are taken in the same
+    order as consecutive slices take them.
+*/
+static void getSlicingPlanes(std::vector<ClipPlane>& planes, int32_t sliceCount, const NvVec3& dir, float start,
+                             float offset, const SlicingConfiguration& conf, RandomGeneratorBase* rnd,
+                             int64_t planeIndex, int32_t materialId)
+{
+    planes.resize(std::max(sliceCount, 0));
+    float position = start + offset;
+    for (int32_t slice = 0; slice < sliceCount; ++slice)
+    {
+        NvVec3 randVect =
+            NvVec3(2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1);
+        NvVec3 lDir = dir + randVect * conf.angle_variations;
+        planes[slice].init(fromNvShared(lDir), fromNvShared(dir * position), planeIndex + slice, materialId);
+        position += offset + (rnd->getRandomValue()) * conf.offset_variations * offset;
+    }
+}
+
+/**
+    Partition every slab by its planes. Slabs are independent and are partitioned on workers, each worker owns its
+    clipper. Slabs are deleted, their non-empty parts are appended to result in slab order.
+*/
+static void partitionSlabs(const std::vector<Mesh*>& slabs, const std::vector<std::vector<ClipPlane>>& planes,
+                           uint32_t threadCount, std::vector<Mesh*>& result)
+{
+    const uint32_t slabCount   = static_cast<uint32_t>(slabs.size());
+    const uint32_t workerCount = getParallelWorkerCount(threadCount, slabCount);
+    std::vector<MeshClipper> clippers(workerCount);
+    std::vector<std::vector<Mesh*>> parts(slabCount);
+
+    parallelFor(workerCount, slabCount, [&](uint32_t w, uint32_t i)
+    {
+        clippers[w].setMesh(slabs[i]);
+        clippers[w].partition(planes[i].data(), static_cast<uint32_t>(planes[i].size()), parts[i]);
+        delete slabs[i];
+    });
+
+    for (const auto& slabParts : parts)
+    {
+        for (Mesh* part : slabParts)
+        {
+            if (part != nullptr)
+            {
+                result.push_back(part);
+            }
+        }
+    }
+}
+
+/**
+    Random values taken by one noisy slice: direction variation (3), noise seed and offset variation
+*/
+#define NOISY_SLICE_RANDOM_VALUE_COUNT 5
+
+/**
+    Heightfields of noisy cuts kept by the cache, within an operation and between operations
+*/
+#define NOISE_SURFACE_CACHE_SIZE 8
+
+/**
+    Noisy cut of a slab, prepared on the calling thread
+*/
+struct NoisySlice
+{
+    NvVec3              normal;
+    NoisyCuttingSurface surface;
+    float               offsetValue;
+};
+
+/**
+    Slice every slab by sliceCount noisy cuts along axis dir, starting at start with step offset. Slab i takes cuts
+    slices[i * sliceCount, (i + 1) * sliceCount) and plane indices from planeIndex + i * sliceCount, so the result
+    doesn't depend on the worker count. Slabs are sliced on workers, each worker owns its boolean evaluator.
+    Slabs other than source are deleted, source is only read. Non-empty slices are appended to result in slab order,
+    a slab which isn't cut is appended as is.
+*/
+static void sliceNoisySlabs(const std::vector<Mesh*>& slabs, const Mesh* source, int32_t sliceCount, const NvVec3& dir,
+                            float start, float offset, const SlicingConfiguration& conf,
+                            const std::vector<NoisySlice>& slices, int64_t planeIndex, int32_t materialId,
+                            uint32_t threadCount, std::vector<Mesh*>& result)
+{
+    const uint32_t slabCount   = static_cast<uint32_t>(slabs.size());
+    const uint32_t workerCount = getParallelWorkerCount(threadCount, slabCount);
+    std::vector<BooleanEvaluator> bTools(workerCount);
+    std::vector<std::vector<Mesh*>> slabSlices(slabCount);
+
+    parallelFor(workerCount, slabCount, [&](uint32_t w, uint32_t i)
+    {
+        Mesh* mesh     = slabs[i];
+        float position = start + offset;
+        for (int32_t slice = 0; slice < sliceCount; ++slice)
+        {
+            const NoisySlice& noisySlice = slices[i * sliceCount + slice];
+            Mesh* slBox = createNoisyCuttingBox(noisySlice.surface, fromNvShared(dir * position),
+                                                fromNvShared(noisySlice.normal), 40, conf.noise.amplitude,
+                                                planeIndex + i * sliceCount + slice, materialId, mesh->getBoundingBox());
+            //  DummyAccelerator accel(mesh->getFacetCount());
+            SweepingAccelerator accel(mesh);
+            SweepingAccelerator dummy(slBox);
+            Mesh* slab      = nullptr;
+            Mesh* remainder = nullptr;
+            bTools[w].performBooleanSplit(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_DIFFERENCE(),
+                                          slab, remainder);
+            if (slab != nullptr)
+            {
+                slabSlices[i].push_back(slab);
+            }
+
+            delete slBox;
+            if (mesh != source)
+            {
+                delete mesh;
+            }
+            mesh = remainder;
+            if (mesh == nullptr)
+            {
+                break;
+            }
+            position += offset + noisySlice.offsetValue * conf.offset_variations * offset;
+        }
+        if (mesh != nullptr)
+        {
+            slabSlices[i].push_back(mesh);
+        }
+    });
+
+    for (const auto& meshes : slabSlices)
+    {
+        result.insert(result.end(), meshes.begin(), meshes.end());
+    }
+}
+
 int32_t FractureToolImpl::slicing(uint32_t chunkId, const SlicingConfiguration& conf, bool replaceChunk,
                                   RandomGeneratorBase* rnd)
 {
@@ -975,10 +1675,15 @@ int32_t FractureToolImpl::slicing(uint32_t chunkId, const SlicingConfiguration&
     }
     chunkInfoIndex = getChunkInfoIndex(chunkId);
 
+    const Mesh* mesh = mChunkData[chunkInfoIndex].getMesh();
 
-    Mesh* mesh = new MeshImpl(*reinterpret_cast<MeshImpl*>(mChunkData[chunkInfoIndex].getMesh()));
-
-    BooleanEvaluator bTool;
+    /**
+    Slices are planar, so each stage partitions a mesh by all its planes in one sweep, slice below a plane is
+    the inside part
+    */
+    MeshClipper clipper;
+    std::vector<ClipPlane> planes;
+    std::vector<Mesh*> parts;
 
     int32_t x_slices = conf.x_slices;
     int32_t y_slices = conf.y_slices;
@@ -986,19 +1691,10 @@ int32_t FractureToolImpl::slicing(uint32_t chunkId, const SlicingConfiguration&
 
     const nvidia::NvBounds3 sourceBBox = toNvShared(mesh->getBoundingBox());
 
-    NvVec3 center = {mesh->getBoundingBox().minimum.x, 0, 0};
-
-
     float x_offset = (sourceBBox.maximum.x - sourceBBox.minimum.x) * (1.0f / (x_slices + 1));
     float y_offset = (sourceBBox.maximum.y - sourceBBox.minimum.y) * (1.0f / (y_slices + 1));
     float z_offset = (sourceBBox.maximum.z - sourceBBox.minimum.z) * (1.0f / (z_slices + 1));
 
-    center.x += x_offset;
-
-    NvVec3 dir = {1, 0, 0};
-
-    Mesh* slBox = getCuttingBox(center, dir, 20, 0, mInteriorMaterialId);
-
     ChunkInfo ch;
     ch.isLeaf           = true;
     ch.isChanged        = true;
@@ -1006,127 +1702,54 @@ int32_t FractureToolImpl::slicing(uint32_t chunkId, const SlicingConfiguration&
     ch.parentChunkId    = replaceChunk ? mChunkData[chunkInfoIndex].parentChunkId : chunkId;
     std::vector<Mesh*> xSlicedChunks;
     std::vector<Mesh*> ySlicedChunks;
+    std::vector<Mesh*> zSlicedChunks;
     std::vector<uint32_t> newlyCreatedChunksIds;
     /**
     Slice along x direction
     */
-    for (int32_t slice = 0; slice < x_slices; ++slice)
+    getSlicingPlanes(planes, x_slices, NvVec3(1, 0, 0), sourceBBox.minimum.x, x_offset, conf, rnd, mPlaneIndexerOffset,
+                     mInteriorMaterialId);
+    mPlaneIndexerOffset += static_cast<int32_t>(planes.size());
+    clipper.setMesh(mesh);
+    clipper.partition(planes.data(), static_cast<uint32_t>(planes.size()), parts);
+    for (Mesh* part : parts)
     {
-        NvVec3 randVect =
-            NvVec3(2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1);
-        NvVec3 lDir = dir + randVect * conf.angle_variations;
-
-        setCuttingBox(center, -lDir, slBox, 20, mPlaneIndexerOffset);
-        bTool.performFastCutting(mesh, slBox, BooleanConfigurations::BOOLEAN_INTERSECTION());
-        Mesh* xSlice = bTool.createNewMesh();
-        if (xSlice != nullptr)
-        {
-            xSlicedChunks.push_back(xSlice);
-        }
-
-        inverseNormalAndIndices(slBox);
-        ++mPlaneIndexerOffset;
-        bTool.performFastCutting(mesh, slBox, BooleanConfigurations::BOOLEAN_DIFFERENCE());
-        Mesh* result = bTool.createNewMesh();
-        delete mesh;
-        mesh = result;
-        if (mesh == nullptr)
+        if (part != nullptr)
         {
-            break;
+            xSlicedChunks.push_back(part);
         }
-        center.x += x_offset + (rnd->getRandomValue()) * conf.offset_variations * x_offset;
     }
-    if (mesh != nullptr)
+
+    /**
+    Slabs are sliced along y and z independently, so they are partitioned on workers. Planes and plane indices are
+    taken here in slab order, the same as on a single thread.
+    */
+    std::vector<std::vector<ClipPlane>> slabPlanes(xSlicedChunks.size());
+    for (auto& yPlanes : slabPlanes)
     {
-        xSlicedChunks.push_back(mesh);
+        getSlicingPlanes(yPlanes, y_slices, NvVec3(0, 1, 0), sourceBBox.minimum.y, y_offset, conf, rnd,
+                         mPlaneIndexerOffset, mInteriorMaterialId);
+        mPlaneIndexerOffset += static_cast<int32_t>(yPlanes.size());
     }
+    partitionSlabs(xSlicedChunks, slabPlanes, mThreadCount, ySlicedChunks);
 
-    for (uint32_t chunk = 0; chunk < xSlicedChunks.size(); ++chunk)
+    slabPlanes.resize(ySlicedChunks.size());
+    for (auto& zPlanes : slabPlanes)
     {
-        center = NvVec3(0, sourceBBox.minimum.y, 0);
-        center.y += y_offset;
-        dir  = NvVec3(0, 1, 0);
-        mesh = xSlicedChunks[chunk];
-
-        for (int32_t slice = 0; slice < y_slices; ++slice)
-        {
-            NvVec3 randVect =
-                NvVec3(2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1);
-            NvVec3 lDir = dir + randVect * conf.angle_variations;
-
-            setCuttingBox(center, -lDir, slBox, 20, mPlaneIndexerOffset);
-            bTool.performFastCutting(mesh, slBox, BooleanConfigurations::BOOLEAN_INTERSECTION());
-            Mesh* ySlice = bTool.createNewMesh();
-            if (ySlice != nullptr)
-            {
-                ySlicedChunks.push_back(ySlice);
-            }
-
-            inverseNormalAndIndices(slBox);
-            ++mPlaneIndexerOffset;
-            bTool.performFastCutting(mesh, slBox, BooleanConfigurations::BOOLEAN_DIFFERENCE());
-            Mesh* result = bTool.createNewMesh();
-            delete mesh;
-            mesh = result;
-            if (mesh == nullptr)
-            {
-                break;
-            }
-            center.y += y_offset + (rnd->getRandomValue()) * conf.offset_variations * y_offset;
-        }
-        if (mesh != nullptr)
-        {
-            ySlicedChunks.push_back(mesh);
-        }
+        getSlicingPlanes(zPlanes, z_slices, NvVec3(0, 0, 1), sourceBBox.minimum.z, z_offset, conf, rnd,
+                         mPlaneIndexerOffset, mInteriorMaterialId);
+        mPlaneIndexerOffset += static_cast<int32_t>(zPlanes.size());
     }
+    partitionSlabs(ySlicedChunks, slabPlanes, mThreadCount, zSlicedChunks);
 
-    for (uint32_t chunk = 0; chunk < ySlicedChunks.size(); ++chunk)
+    for (Mesh* slice : zSlicedChunks)
     {
-        center = NvVec3(0, 0, sourceBBox.minimum.z);
-        center.z += z_offset;
-        dir  = NvVec3(0, 0, 1);
-        mesh = ySlicedChunks[chunk];
-
-        for (int32_t slice = 0; slice < z_slices; ++slice)
-        {
-            NvVec3 randVect =
-                NvVec3(2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1);
-            NvVec3 lDir = dir + randVect * conf.angle_variations;
-
-            setCuttingBox(center, -lDir, slBox, 20, mPlaneIndexerOffset);
-            bTool.performFastCutting(mesh, slBox, BooleanConfigurations::BOOLEAN_INTERSECTION());
-            Mesh* ySlice = bTool.createNewMesh();
-            if (ySlice != nullptr)
-            {
-                setChunkInfoMesh(ch, ySlice);
-                ch.chunkId = createId();
-                newlyCreatedChunksIds.push_back(ch.chunkId);
-                mChunkData.push_back(ch);
-            }
-
-            inverseNormalAndIndices(slBox);
-            ++mPlaneIndexerOffset;
-            bTool.performFastCutting(mesh, slBox, BooleanConfigurations::BOOLEAN_DIFFERENCE());
-            Mesh* result = bTool.createNewMesh();
-            delete mesh;
-            mesh = result;
-            if (mesh == nullptr)
-            {
-                break;
-            }
-            center.z += z_offset + (rnd->getRandomValue()) * conf.offset_variations * z_offset;
-        }
-        if (mesh != nullptr)
-        {
-            setChunkInfoMesh(ch, mesh);
-            ch.chunkId  = createId();
-            newlyCreatedChunksIds.push_back(ch.chunkId);
-            mChunkData.push_back(ch);
-        }
+        setChunkInfoMesh(ch, slice);
+        ch.chunkId = createId();
+        newlyCreatedChunksIds.push_back(ch.chunkId);
+        addChunkInfo(ch);
     }
 
-    delete slBox;
-
     mChunkData[chunkInfoIndex].isLeaf = false;
     if (replaceChunk)
     {
@@ -1163,22 +1786,17 @@ int32_t FractureToolImpl::slicingNoisy(uint32_t chunkId, const SlicingConfigurat
     }
     chunkInfoIndex = getChunkInfoIndex(chunkId);
 
-
-    Mesh* mesh = new MeshImpl(*reinterpret_cast<MeshImpl*>(mChunkData[chunkInfoIndex].getMesh()));
+    // Chunk mesh is only read, stages don't delete it
+    Mesh* mesh = mChunkData[chunkInfoIndex].getMesh();
 
     const TransformST& tm = mChunkData[chunkInfoIndex].getTmToWorld();
 
-    BooleanEvaluator bTool;
-
-    int32_t x_slices = conf.x_slices;
-    int32_t y_slices = conf.y_slices;
-    int32_t z_slices = conf.z_slices;
+    int32_t x_slices = std::max(conf.x_slices, 0);
+    int32_t y_slices = std::max(conf.y_slices, 0);
+    int32_t z_slices = std::max(conf.z_slices, 0);
 
     const nvidia::NvBounds3 sourceBBox = toNvShared(mesh->getBoundingBox());
 
-    NvVec3 center = NvVec3(mesh->getBoundingBox().minimum.x, 0, 0);
-
-
     float x_offset = (sourceBBox.maximum.x - sourceBBox.minimum.x) * (1.0f / (x_slices + 1));
     float y_offset = (sourceBBox.maximum.y - sourceBBox.minimum.y) * (1.0f / (y_slices + 1));
     float z_offset = (sourceBBox.maximum.z - sourceBBox.minimum.z) * (1.0f / (z_slices + 1));
@@ -1186,12 +1804,7 @@ int32_t FractureToolImpl::slicingNoisy(uint32_t chunkId, const SlicingConfigurat
     NvVec3 resolution(tm.s / conf.noise.samplingInterval.x,
                       tm.s / conf.noise.samplingInterval.y,
                       tm.s / conf.noise.samplingInterval.z);
-
-    center.x += x_offset;
-
-    NvVec3 dir(1, 0, 0);
-
-    Mesh* slBox = nullptr;
+    const float noisyPartSize = 1.2f;
 
     ChunkInfo ch;
     ch.isLeaf           = true;
@@ -1200,150 +1813,74 @@ int32_t FractureToolImpl::slicingNoisy(uint32_t chunkId, const SlicingConfigurat
     ch.parentChunkId    = replaceChunk ? mChunkData[chunkInfoIndex].parentChunkId : chunkId;
     std::vector<Mesh*> xSlicedChunks;
     std::vector<Mesh*> ySlicedChunks;
+    std::vector<Mesh*> zSlicedChunks;
     std::vector<uint32_t> newlyCreatedChunksIds;
-    float noisyPartSize = 1.2f;
-    //  int32_t acceleratorRes = 8;
-    /**
-        Slice along x direction
-    */
-    for (int32_t slice = 0; slice < x_slices; ++slice)
-    {
-        NvVec3 randVect =
-            NvVec3(2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1);
-        NvVec3 lDir = dir + randVect * conf.angle_variations;
-        slBox        = getNoisyCuttingBoxPair(center, lDir, 40, noisyPartSize, resolution,
-                                       mPlaneIndexerOffset, conf.noise.amplitude,
-                                       conf.noise.frequency, conf.noise.octaveNumber, rnd->getRandomValue(),
-                                       mInteriorMaterialId);
-        //  DummyAccelerator accel(mesh->getFacetCount());
-        SweepingAccelerator accel(mesh);
-        SweepingAccelerator dummy(slBox);
-        bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_DIFFERENCE());
-        Mesh* xSlice = bTool.createNewMesh();
-        if (xSlice != nullptr)
-        {
-            xSlicedChunks.push_back(xSlice);
-        }
-
-        inverseNormalAndIndices(slBox);
-        ++mPlaneIndexerOffset;
-        bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_INTERSECTION());
-        Mesh* result = bTool.createNewMesh();
-        delete slBox;
-        delete mesh;
-        mesh = result;
-        if (mesh == nullptr)
-        {
-            break;
-        }
-        center.x += x_offset + (rnd->getRandomValue()) * conf.offset_variations * x_offset;
-    }
-    if (mesh != nullptr)
-    {
-        xSlicedChunks.push_back(mesh);
-    }
+    std::vector<NoisySlice> slices;
 
-    slBox                    = getCuttingBox(center, dir, 20, 0, mInteriorMaterialId);
-    uint32_t slicedChunkSize = xSlicedChunks.size();
-    for (uint32_t chunk = 0; chunk < slicedChunkSize; ++chunk)
+    if (mNoiseSurfaces == nullptr)
     {
-        center = NvVec3(0, sourceBBox.minimum.y, 0);
-        center.y += y_offset;
-        dir  = NvVec3(0, 1, 0);
-        mesh = xSlicedChunks[chunk];
-
-        for (int32_t slice = 0; slice < y_slices; ++slice)
-        {
-            NvVec3 randVect =
-                NvVec3(2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1);
-            NvVec3 lDir = dir + randVect * conf.angle_variations;
-
-            slBox = getNoisyCuttingBoxPair(center, lDir, 40, noisyPartSize, resolution,
-                                           mPlaneIndexerOffset, conf.noise.amplitude,
-                                           conf.noise.frequency, conf.noise.octaveNumber, rnd->getRandomValue(),
-                                           mInteriorMaterialId);
-            //  DummyAccelerator accel(mesh->getFacetCount());
-            SweepingAccelerator accel(mesh);
-            SweepingAccelerator dummy(slBox);
-            bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_DIFFERENCE());
-            Mesh* ySlice = bTool.createNewMesh();
-            if (ySlice != nullptr)
-            {
-                ySlicedChunks.push_back(ySlice);
-            }
-
-            inverseNormalAndIndices(slBox);
-            ++mPlaneIndexerOffset;
-            bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_INTERSECTION());
-            Mesh* result = bTool.createNewMesh();
-            delete slBox;
-            delete mesh;
-            mesh = result;
-            if (mesh == nullptr)
-            {
-                break;
-            }
-            center.y += y_offset + (rnd->getRandomValue()) * conf.offset_variations * y_offset;
-        }
-        if (mesh != nullptr)
-        {
-            ySlicedChunks.push_back(mesh);
-        }
+        mNoiseSurfaces = new NoiseSurfaceCache(NOISE_SURFACE_CACHE_SIZE);
     }
 
-    for (uint32_t chunk = 0; chunk < ySlicedChunks.size(); ++chunk)
+    /**
+    Each stage takes all random values, noise surfaces and plane indices of its slabs up front, in slab order. Slabs of
+    the y and z stages are independent, they are sliced on workers with the same result as on a single thread.
+    Noise seed is the integer part of the seed value, as it always was, so it is always 0; the value itself picks the
+    window of the cached noise. Heightfield is keyed on the stage resolution, not on the slice normal, so it is
+    computed once for all slices of the stage.
+    */
+    auto sliceStage = [&](const std::vector<Mesh*>& slabs, int32_t sliceCount, const NvVec3& dir, float start,
+                          float offset, std::vector<Mesh*>& result)
     {
-        center = NvVec3(0, 0, sourceBBox.minimum.z);
-        center.z += z_offset;
-        dir  = NvVec3(0, 0, 1);
-        mesh = ySlicedChunks[chunk];
-
-        for (int32_t slice = 0; slice < z_slices; ++slice)
+        slices.resize(slabs.size() * sliceCount);
+        for (NoisySlice& slice : slices)
         {
-            NvVec3 randVect =
-                NvVec3(2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1, 2 * rnd->getRandomValue() - 1);
-            NvVec3 lDir = dir + randVect * conf.angle_variations;
-            slBox        = getNoisyCuttingBoxPair(center, lDir, 40, noisyPartSize, resolution,
-                                           mPlaneIndexerOffset, conf.noise.amplitude,
-                                           conf.noise.frequency, conf.noise.octaveNumber, rnd->getRandomValue(),
-                                           mInteriorMaterialId);
-            //      DummyAccelerator accel(mesh->getFacetCount());
-            SweepingAccelerator accel(mesh);
-            SweepingAccelerator dummy(slBox);
-            bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_DIFFERENCE());
-            Mesh* ySlice = bTool.createNewMesh();
-            if (ySlice != nullptr)
+            float values[NOISY_SLICE_RANDOM_VALUE_COUNT];
+            for (float& value : values)
             {
-                setChunkInfoMesh(ch, ySlice);
-                ch.chunkId = createId();
-                mChunkData.push_back(ch);
-                newlyCreatedChunksIds.push_back(ch.chunkId);
+                value = rnd->getRandomValue();
             }
+            NvVec3 randVect   = NvVec3(2 * values[0] - 1, 2 * values[1] - 1, 2 * values[2] - 1);
+            slice.normal      = dir + randVect * conf.angle_variations;
+            slice.surface     = mNoiseSurfaces->getSurface(noisyPartSize, fromNvShared(resolution),
+                                                           conf.noise.frequency, conf.noise.octaveNumber,
+                                                           static_cast<int32_t>(values[3]), values[3]);
+            slice.offsetValue = values[4];
+        }
+        const int64_t planeIndex = mPlaneIndexerOffset;
+        mPlaneIndexerOffset += static_cast<int64_t>(slabs.size()) * sliceCount;
+        sliceNoisySlabs(slabs, mesh, sliceCount, dir, start, offset, conf, slices, planeIndex, mInteriorMaterialId,
+                        mThreadCount, result);
+    };
 
-            inverseNormalAndIndices(slBox);
-            ++mPlaneIndexerOffset;
-            bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_INTERSECTION());
-            Mesh* result = bTool.createNewMesh();
-            delete mesh;
-            delete slBox;
-            mesh = result;
-            if (mesh == nullptr)
-            {
-                break;
-            }
-            center.z += z_offset + (rnd->getRandomValue()) * conf.offset_variations * z_offset;
-        }
-        if (mesh != nullptr)
-        {
-            setChunkInfoMesh(ch, mesh);
-            ch.chunkId  = createId();
-            newlyCreatedChunksIds.push_back(ch.chunkId);
-            mChunkData.push_back(ch);
+    /**
+        Slice along x direction, then slabs along y and z
+    */
+    sliceStage(std::vector<Mesh*>(1, mesh), x_slices, NvVec3(1, 0, 0), sourceBBox.minimum.x, x_offset, xSlicedChunks);
+    sliceStage(xSlicedChunks, y_slices, NvVec3(0, 1, 0), sourceBBox.minimum.y, y_offset, ySlicedChunks);
+    sliceStage(ySlicedChunks, z_slices, NvVec3(0, 0, 1), sourceBBox.minimum.z, z_offset, zSlicedChunks);
+
+    for (Mesh* slice : zSlicedChunks)
+    {
+        if (slice == mesh)
+        {
+            // Chunk isn't cut, the new chunk shares its mesh and transform
+            ChunkInfo uncut     = mChunkData[chunkInfoIndex];
+            uncut.parentChunkId = ch.parentChunkId;
+            uncut.flags         = ch.flags;
+            uncut.isChanged     = true;
+            uncut.chunkId       = createId();
+            mChunkMeshRefs.acquire(mesh);
+            addChunkInfo(uncut);
+            newlyCreatedChunksIds.push_back(uncut.chunkId);
+            continue;
         }
+        setChunkInfoMesh(ch, slice);
+        ch.chunkId = createId();
+        addChunkInfo(ch);
+        newlyCreatedChunksIds.push_back(ch.chunkId);
     }
 
-    //  delete slBox;
-
     mChunkData[chunkInfoIndex].isLeaf = false;
     if (replaceChunk)
     {
@@ -1380,7 +1917,7 @@ int32_t FractureToolImpl::cut(uint32_t chunkId, const NvcVec3& normal, const Nvc
     }
     chunkInfoIndex = getChunkInfoIndex(chunkId);
 
-    Mesh* mesh = new MeshImpl(*reinterpret_cast<MeshImpl*>(mChunkData[chunkInfoIndex].getMesh()));
+    const Mesh* sourceMesh = mChunkData[chunkInfoIndex].getMesh();
     BooleanEvaluator bTool;
 
     const TransformST& tm = mChunkData[chunkInfoIndex].getTmToWorld();
@@ -1398,22 +1935,40 @@ int32_t FractureToolImpl::cut(uint32_t chunkId, const NvcVec3& normal, const Nvc
                       tm.s / noise.samplingInterval.z);
 
     // Perform cut
-    Mesh* slBox = getNoisyCuttingBoxPair(toNvShared(tm.invTransformPos(point)),
-                                         toNvShared(normal),    // tm doesn't change normals (up to normalization)
-                                         40, noisyPartSize, resolution,
-                                         mPlaneIndexerOffset, noise.amplitude, noise.frequency,
-                                         noise.octaveNumber, rnd->getRandomValue(), mInteriorMaterialId);
-    SweepingAccelerator accel(mesh);
-    SweepingAccelerator dummy(slBox);
-    bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_DIFFERENCE());
-    setChunkInfoMesh(ch, bTool.createNewMesh());
-    inverseNormalAndIndices(slBox);
+    Mesh* cutPart = nullptr;
+    Mesh* result  = nullptr;
+    if (noise.amplitude == 0)
+    {
+        // Planar cut is exact with plane clipping, part behind the plane is the inside part
+        ClipPlane plane;
+        plane.init(normal,    // tm doesn't change normals (up to normalization)
+                   tm.invTransformPos(point), mPlaneIndexerOffset, mInteriorMaterialId);
+        MeshClipper clipper;
+        clipper.setMesh(sourceMesh);
+        clipper.split(plane, cutPart, result);
+    }
+    else
+    {
+        if (mNoiseSurfaces == nullptr)
+        {
+            mNoiseSurfaces = new NoiseSurfaceCache(NOISE_SURFACE_CACHE_SIZE);
+        }
+        const float seedValue = rnd->getRandomValue();
+        const NoisyCuttingSurface surface =
+            mNoiseSurfaces->getSurface(noisyPartSize, fromNvShared(resolution), noise.frequency,
+                                       noise.octaveNumber, static_cast<int32_t>(seedValue), seedValue);
+        Mesh* slBox = createNoisyCuttingBox(surface, tm.invTransformPos(point),
+                                            normal,    // tm doesn't change normals (up to normalization)
+                                            40, noise.amplitude, mPlaneIndexerOffset, mInteriorMaterialId,
+                                            sourceMesh->getBoundingBox());
+        SweepingAccelerator accel(sourceMesh);
+        SweepingAccelerator dummy(slBox);
+        bTool.performBooleanSplit(sourceMesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_DIFFERENCE(), cutPart, result);
+        delete slBox;
+    }
+    setChunkInfoMesh(ch, cutPart);
     ++mPlaneIndexerOffset;
-    bTool.performBoolean(mesh, slBox, &accel, &dummy, BooleanConfigurations::BOOLEAN_INTERSECTION());
-    Mesh* result = bTool.createNewMesh();
-    delete slBox;
-    delete mesh;
-    mesh = result;
+    Mesh* mesh = result;
 
     if (mesh == 0)  // Return if it doesn't cut specified chunk
     {
@@ -1430,14 +1985,14 @@ int32_t FractureToolImpl::cut(uint32_t chunkId, const NvcVec3& normal, const Nvc
     if (ch.getMesh() != 0)
     {
         ch.chunkId = createId();
-        mChunkData.push_back(ch);
+        addChunkInfo(ch);
         firstChunkId = ch.chunkId;
     }
     if (mesh != 0)
     {
         ch.chunkId  = createId();
         setChunkInfoMesh(ch, mesh);
-        mChunkData.push_back(ch);
+        addChunkInfo(ch);
     }
 
     mChunkData[chunkInfoIndex].isLeaf = false;
@@ -1474,6 +2029,34 @@ bool CmpVec::operator()(const NvVec3& v1, const NvVec3& v2) const
 }
 
 
+/**
+    Range of projections of box corners on axis
+*/
+static void getProjectedRange(const nvidia::NvBounds3& bounds, const NvVec3& axis, float range[2])
+{
+    const NvVec3 center  = bounds.getCenter();
+    const NvVec3 extents = bounds.getExtents();
+    const float c        = center.dot(axis);
+    const float e        = extents.dot(axis.abs());
+    range[0]             = c - e;
+    range[1]             = c + e;
+}
+
+/**
+    Set vertices and bounds of view to those of source moved by offset. View is a copy of source.
+*/
+static void setTranslatedMesh(const Mesh* source, const NvVec3& offset, Mesh* view)
+{
+    const Vertex* sourceVertices = source->getVertices();
+    Vertex* vertices             = view->getVerticesWritable();
+    for (uint32_t v = 0; v < source->getVerticesCount(); v++)
+    {
+        toNvShared(vertices[v].p) = toNvShared(sourceVertices[v].p) + offset;
+    }
+    toNvShared(view->getBoundingBoxWritable().minimum) = toNvShared(source->getBoundingBox().minimum) + offset;
+    toNvShared(view->getBoundingBoxWritable().maximum) = toNvShared(source->getBoundingBox().maximum) + offset;
+}
+
 int32_t FractureToolImpl::cutout(uint32_t chunkId, CutoutConfiguration conf, bool replaceChunk, RandomGeneratorBase* rnd)
 {
     if ((replaceChunk && chunkId == 0) || conf.cutoutSet == nullptr)
@@ -1495,7 +2078,7 @@ int32_t FractureToolImpl::cutout(uint32_t chunkId, CutoutConfiguration conf, boo
 
     const TransformST& tm = mChunkData[chunkInfoIndex].getTmToWorld();
 
-    Mesh* mesh            = new MeshImpl(*reinterpret_cast<MeshImpl*>(mChunkData[chunkInfoIndex].getMesh()));
+    const Mesh* mesh      = mChunkData[chunkInfoIndex].getMesh();
     float extrusionLength = toNvShared(mesh->getBoundingBox()).getDimensions().magnitude();
     auto scale            = toNvShared(conf.scale);
     conf.transform.p      = tm.invTransformPos(conf.transform.p);
@@ -1574,101 +2157,175 @@ int32_t FractureToolImpl::cutout(uint32_t chunkId, CutoutConfiguration conf, boo
     buildCuttingConeFaces(conf, verts, heightBot, heightTop, conicityMultiplierBot, conicityMultiplierTop,
                           mPlaneIndexerOffset, seed, mInteriorMaterialId, sharedFacesMap);
 
-    std::vector<std::vector<Mesh*> > cutoutMeshes;
-    for (uint32_t c = 0; c < cutoutSet.getCutoutCount(); c++)
+    std::vector<std::vector<Mesh*> > cutoutMeshes;
+    for (uint32_t c = 0; c < cutoutSet.getCutoutCount(); c++)
+    {
+        cutoutMeshes.push_back(std::vector<Mesh*>());
+        for (uint32_t l = 0; l < cutoutSet.getCutoutLoopCount(c); l++)
+        {
+            if (verts[cutoutStarts[c] + l].size() < 4)
+            {
+                continue;
+            }
+            cutoutMeshes.back().push_back(
+                getCuttingCone(conf, verts[cutoutStarts[c] + l], smoothingGroups[cutoutStarts[c] + l], heightBot,
+                               heightTop, conicityMultiplierBot, conicityMultiplierTop, mPlaneIndexerOffset, seed,
+                               mInteriorMaterialId, sharedFacesMap, l != 0));
+        }
+    }
+
+    /**
+    Cells are enumerated up front. Periodic cutouts take every cell whose translated cutout bounds can reach the chunk
+    bounds in the cutout plane, a cutout of a cell is evaluated only if its bounds overlap the chunk bounds.
+    */
+    const nvidia::NvTransform cutoutTransform = toNvShared(conf.transform);
+    const nvidia::NvBounds3 meshBounds = toNvShared(mesh->getBoundingBox());
+    std::vector<std::pair<int32_t, int32_t> > cells;
+    if (cutoutSet.isPeriodic() && scale.x > 0.f && scale.y > 0.f)
+    {
+        const NvVec3 axisX = cutoutTransform.rotate(NvVec3(1, 0, 0));
+        const NvVec3 axisY = cutoutTransform.rotate(NvVec3(0, 1, 0));
+        nvidia::NvBounds3 cutoutBounds = nvidia::NvBounds3::empty();
+        for (uint32_t c = 0; c < cutoutMeshes.size(); c++)
+        {
+            for (uint32_t l = 0; l < cutoutMeshes[c].size(); l++)
+            {
+                if (cutoutMeshes[c][l] != nullptr)
+                {
+                    cutoutBounds.include(toNvShared(cutoutMeshes[c][l]->getBoundingBox()));
+                }
+            }
+        }
+        if (!cutoutBounds.isEmpty())
+        {
+            float meshRange[2][2], cutoutRange[2][2];
+            getProjectedRange(meshBounds, axisX, meshRange[0]);
+            getProjectedRange(meshBounds, axisY, meshRange[1]);
+            getProjectedRange(cutoutBounds, axisX, cutoutRange[0]);
+            getProjectedRange(cutoutBounds, axisY, cutoutRange[1]);
+            const int32_t xMin = (int32_t)std::ceil((meshRange[0][0] - cutoutRange[0][1]) / scale.x);
+            const int32_t xMax = (int32_t)std::floor((meshRange[0][1] - cutoutRange[0][0]) / scale.x);
+            const int32_t yMin = (int32_t)std::ceil((meshRange[1][0] - cutoutRange[1][1]) / scale.y);
+            const int32_t yMax = (int32_t)std::floor((meshRange[1][1] - cutoutRange[1][0]) / scale.y);
+            for (int32_t y = yMin; y <= yMax; ++y)
+            {
+                for (int32_t x = xMin; x <= xMax; ++x)
+                {
+                    cells.push_back(std::make_pair(x, y));
+                }
+            }
+        }
+    }
+    else
+    {
+        cells.push_back(std::make_pair(0, 0));
+    }
+
+    // Work items are (cell, cutout) pairs in cell order, chunks are created in this order
+    std::vector<std::pair<uint32_t, uint32_t> > items;
+    for (uint32_t i = 0; i < cells.size(); ++i)
     {
-        cutoutMeshes.push_back(std::vector<Mesh*>());
-        for (uint32_t l = 0; l < cutoutSet.getCutoutLoopCount(c); l++)
+        const NvVec3 offset =
+            cutoutTransform.rotate(NvVec3(cells[i].first * scale.x, cells[i].second * scale.y, 0));
+        for (uint32_t c = 0; c < cutoutMeshes.size(); c++)
         {
-            if (verts[cutoutStarts[c] + l].size() < 4)
+            if (cutoutMeshes[c].empty() || cutoutMeshes[c][0] == nullptr)
             {
                 continue;
             }
-            cutoutMeshes.back().push_back(
-                getCuttingCone(conf, verts[cutoutStarts[c] + l], smoothingGroups[cutoutStarts[c] + l], heightBot,
-                               heightTop, conicityMultiplierBot, conicityMultiplierTop, mPlaneIndexerOffset, seed,
-                               mInteriorMaterialId, sharedFacesMap, l != 0));
+            nvidia::NvBounds3 bounds = toNvShared(cutoutMeshes[c][0]->getBoundingBox());
+            bounds.minimum += offset;
+            bounds.maximum += offset;
+            if (bounds.intersects(meshBounds))
+            {
+                items.push_back(std::make_pair(i, c));
+            }
         }
     }
 
-    std::stack<std::pair<int32_t, int32_t> > cellsStack;
-    std::set<std::pair<int32_t, int32_t> > visited;
-    cellsStack.push(std::make_pair(0, 0));
-
-    while (!cellsStack.empty())
+    /**
+    Each worker owns its boolean evaluator and copies of the cutout meshes, which are moved to the cell being
+    evaluated. Shared cutout meshes and the chunk mesh are only read.
+    */
+    struct CutoutWorker
     {
-        auto cell            = cellsStack.top();
-        auto transformedCell = toNvShared(conf.transform).rotate(NvVec3(cell.first * scale.x, cell.second * scale.y, 0));
-        cellsStack.pop();
-        if (visited.find(cell) != visited.end())
-        {
-            continue;
-        }
-        visited.insert(cell);
-
+        BooleanEvaluator                    bTool;
+        std::vector<std::vector<Mesh*> >    views;
+    };
+    const uint32_t itemCount   = static_cast<uint32_t>(items.size());
+    const uint32_t workerCount = getParallelWorkerCount(mThreadCount, itemCount);
+    std::vector<CutoutWorker> workers(workerCount);
+    std::vector<Mesh*> itemMeshes(itemCount, nullptr);
 
-        bool hasCutout = false;
-        for (uint32_t c = 0; c < cutoutMeshes.size(); c++)
+    parallelFor(workerCount, itemCount, [&](uint32_t w, uint32_t item)
+    {
+        CutoutWorker& worker = workers[w];
+        if (worker.views.empty())
         {
-            setChunkInfoMesh(ch, nullptr);
-            for (uint32_t l = 0; l < cutoutMeshes[c].size(); l++)
+            worker.views.resize(cutoutMeshes.size());
+            for (uint32_t c = 0; c < cutoutMeshes.size(); c++)
             {
-                Mesh* cutoutMesh = cutoutMeshes[c][l];
-                if (cutoutMesh == nullptr)
-                {
-                    continue;
-                }
-                auto vertices = cutoutMesh->getVerticesWritable();
-                for (uint32_t v = 0; v < cutoutMesh->getVerticesCount(); v++)
-                {
-                    toNvShared(vertices[v].p) += transformedCell;
-                }
-                toNvShared(cutoutMesh->getBoundingBoxWritable().minimum) += transformedCell;
-                toNvShared(cutoutMesh->getBoundingBoxWritable().maximum) += transformedCell;
-                if (l == 0)
+                for (Mesh* cutoutMesh : cutoutMeshes[c])
                 {
-                    SweepingAccelerator accel(mesh);
-                    SweepingAccelerator dummy(cutoutMesh);
-                    bTool.performBoolean(mesh, cutoutMesh, &accel, &dummy, BooleanConfigurations::BOOLEAN_INTERSECTION());
-
-                    setChunkInfoMesh(ch, bTool.createNewMesh());
+                    worker.views[c].push_back(cutoutMesh != nullptr ?
+                                              new MeshImpl(*reinterpret_cast<MeshImpl*>(cutoutMesh)) : nullptr);
                 }
-                else
-                {
-                    SweepingAccelerator accel(ch.getMesh());
-                    SweepingAccelerator dummy(cutoutMesh);
-                    bTool.performBoolean(ch.getMesh(), cutoutMesh, &accel, &dummy,
-                                         BooleanConfigurations::BOOLEAN_DIFFERENCE());
+            }
+        }
 
-                    setChunkInfoMesh(ch, bTool.createNewMesh());
-                }
-                for (uint32_t v = 0; v < cutoutMesh->getVerticesCount(); v++)
-                {
-                    toNvShared(vertices[v].p) -= transformedCell;
-                }
-                toNvShared(cutoutMesh->getBoundingBoxWritable().minimum )-= transformedCell;
-                toNvShared(cutoutMesh->getBoundingBoxWritable().maximum) -= transformedCell;
+        const auto& cell    = cells[items[item].first];
+        const uint32_t c    = items[item].second;
+        const NvVec3 offset = cutoutTransform.rotate(NvVec3(cell.first * scale.x, cell.second * scale.y, 0));
+        Mesh* result        = nullptr;
+        for (uint32_t l = 0; l < cutoutMeshes[c].size(); l++)
+        {
+            Mesh* view = worker.views[c][l];
+            if (view == nullptr)
+            {
+                continue;
             }
-            if (ch.getMesh() != 0)
+            setTranslatedMesh(cutoutMeshes[c][l], offset, view);
+            if (l == 0)
             {
-                ch.chunkId = createId();
-                newlyCreatedChunksIds.push_back(ch.chunkId);
-                mChunkData.push_back(ch);
-                hasCutout = true;
+                SweepingAccelerator accel(mesh);
+                SweepingAccelerator dummy(view);
+                worker.bTool.performBoolean(mesh, view, &accel, &dummy, BooleanConfigurations::BOOLEAN_INTERSECTION());
+                result = worker.bTool.createNewMesh();
             }
+            else
+            {
+                SweepingAccelerator accel(result);
+                SweepingAccelerator dummy(view);
+                worker.bTool.performBoolean(result, view, &accel, &dummy, BooleanConfigurations::BOOLEAN_DIFFERENCE());
+                delete result;
+                result = worker.bTool.createNewMesh();
+            }
+            if (result == nullptr)
+            {
+                break;
+            }
+        }
+        itemMeshes[item] = result;
+    });
+
+    for (uint32_t item = 0; item < itemCount; ++item)
+    {
+        if (itemMeshes[item] != nullptr)
+        {
+            ch.chunkId = createId();
+            setChunkInfoMesh(ch, itemMeshes[item]);
+            newlyCreatedChunksIds.push_back(ch.chunkId);
+            addChunkInfo(ch);
         }
+    }
 
-        if (hasCutout && cutoutSet.isPeriodic())
+    for (CutoutWorker& worker : workers)
+    {
+        for (auto& views : worker.views)
         {
-            for (int32_t i = 0; i < 4; ++i)
+            for (Mesh*& view : views)
             {
-                const int32_t i0 = i & 1;
-                const int32_t i1 = (i >> 1) & 1;
-                auto newCell     = std::make_pair(cell.first + i0 - i1, cell.second + i0 + i1 - 1);
-                if (visited.find(newCell) == visited.end())
-                {
-                    cellsStack.push(newCell);
-                }
+                SAFE_DELETE(view);
             }
         }
     }
@@ -1680,7 +2337,6 @@ int32_t FractureToolImpl::cutout(uint32_t chunkId, CutoutConfiguration conf, boo
             SAFE_DELETE(cutoutMeshes[c][l]);
         }
     }
-    SAFE_DELETE(mesh);
 
     mChunkData[chunkInfoIndex].isLeaf = false;
     if (replaceChunk)
@@ -1701,49 +2357,52 @@ int32_t FractureToolImpl::cutout(uint32_t chunkId, CutoutConfiguration conf, boo
 
 int32_t FractureToolImpl::getChunkInfoIndex(int32_t chunkId) const
 {
-    for (uint32_t i = 0; i < mChunkData.size(); ++i)
+    auto it = mChunkIndex.find(chunkId);
+    if (it == mChunkIndex.end())
     {
-        if (mChunkData[i].chunkId == chunkId)
-        {
-            return i;
-        }
+        return -1;
     }
-    return -1;
+    NVBLAST_ASSERT(mChunkData[it->second].chunkId == chunkId);
+    return it->second;
 }
 
 int32_t FractureToolImpl::getChunkDepth(int32_t chunkId) const
 {
-    int32_t chunkInfoIndex = getChunkInfoIndex(chunkId);
+    const int32_t chunkInfoIndex = getChunkInfoIndex(chunkId);
     if (chunkInfoIndex == -1)
     {
         return -1;
     }
+    return mChunkDepths[chunkInfoIndex];
+}
 
-    int32_t depth = 0;
+uint32_t FractureToolImpl::getChunksIdAtDepth(uint32_t depth, int32_t*& chunkIds) const
+{
+    uint32_t count = 0;
+    for (int32_t chunkDepth : mChunkDepths)
+    {
+        count += chunkDepth == (int32_t)depth ? 1 : 0;
+    }
+    chunkIds = new int32_t[count];
 
-    while (mChunkData[chunkInfoIndex].parentChunkId != -1)
+    uint32_t cursor = 0;
+    for (uint32_t i = 0; i < count; ++i)
     {
-        ++depth;
-        chunkInfoIndex = getChunkInfoIndex(mChunkData[chunkInfoIndex].parentChunkId);
+        chunkIds[i] = getNextChunkIdAtDepth(depth, cursor);
     }
-    return depth;
+    return count;
 }
 
-uint32_t FractureToolImpl::getChunksIdAtDepth(uint32_t depth, int32_t*& chunkIds) const
+int32_t FractureToolImpl::getNextChunkIdAtDepth(uint32_t depth, uint32_t& cursor) const
 {
-    std::vector<int32_t> _chunkIds;
-
-    for (uint32_t i = 0; i < mChunkData.size(); ++i)
+    for (; cursor < mChunkDepths.size(); ++cursor)
     {
-        if (getChunkDepth(mChunkData[i].chunkId) == (int32_t)depth)
+        if (mChunkDepths[cursor] == (int32_t)depth)
         {
-            _chunkIds.push_back(mChunkData[i].chunkId);
+            return mChunkData[cursor++].chunkId;
         }
     }
-    chunkIds = new int32_t[_chunkIds.size()];
-    memcpy(chunkIds, _chunkIds.data(), _chunkIds.size() * sizeof(int32_t));
-
-    return (uint32_t)_chunkIds.size();
+    return -1;
 }
 
 bool FractureToolImpl::setSourceMeshes(Mesh const * const * meshes, uint32_t meshesSize, const int32_t* ids /* = nullptr */)
@@ -1799,13 +2458,13 @@ int32_t FractureToolImpl::setChunkMesh(const Mesh* meshInput, int32_t parentId,
         return -1;
     }
 
-    mChunkData.push_back(ChunkInfo());
-    auto& chunk         = mChunkData.back();
-    chunk.chunkId       = chunkId;
-    chunk.parentChunkId = parentId;
-    chunk.isLeaf        = true;
-    chunk.isChanged     = true;
-    chunk.flags         = ChunkInfo::NO_FLAGS;
+    ChunkInfo newChunk;
+    newChunk.chunkId       = chunkId;
+    newChunk.parentChunkId = parentId;
+    newChunk.isLeaf        = true;
+    newChunk.isChanged     = true;
+    newChunk.flags         = ChunkInfo::NO_FLAGS;
+    auto& chunk            = mChunkData[addChunkInfo(newChunk)];
 
     /**
     Set mesh; move to origin and scale to unit cube
@@ -1838,18 +2497,25 @@ void FractureToolImpl::reset()
 {
     for (uint32_t i = 0; i < mChunkPostprocessors.size(); ++i)
     {
-        delete mChunkPostprocessors[i];
+        mChunkMeshRefs.release(mChunkPostprocessors[i]);
     }
     mChunkPostprocessors.clear();
     for (uint32_t i = 0; i < mChunkData.size(); ++i)
     {
-        delete mChunkData[i].getMesh();
+        mChunkMeshRefs.release(mChunkData[i].getMesh());
     }
     mChunkData.clear();
+    mChunkIndex.clear();
+    mChunkParents.clear();
+    mChunkDepths.clear();
+    mChunkChildSlots.clear();
+    mChunkChildren.clear();
+    mRemovedChunkCount = 0;
     mPlaneIndexerOffset = 1;
-    mNextChunkId = 0;
-    mChunkIdsUsed.clear();
+    mChunkIds.reset();
     mInteriorMaterialId = kMaterialInteriorId;
+    delete mNoiseSurfaces;
+    mNoiseSurfaces = nullptr;
 }
 
 
@@ -1860,49 +2526,47 @@ void FractureToolImpl::setInteriorMaterialId(int32_t materialId)
 
 bool FractureToolImpl::isAncestorForChunk(int32_t ancestorId, int32_t chunkId)
 {
-    if (ancestorId == chunkId)
+    const int32_t ancestorIndex = getChunkInfoIndex(ancestorId);
+    int32_t chunkInfoIndex      = getChunkInfoIndex(chunkId);
+    if (ancestorIndex == -1 || chunkInfoIndex == -1)
     {
         return false;
     }
-    while (chunkId != -1)
+    while (mChunkDepths[chunkInfoIndex] > mChunkDepths[ancestorIndex])
     {
-        if (ancestorId == chunkId)
-        {
-            return true;
-        }
-        const int32_t chunkInfoIndex = getChunkInfoIndex(chunkId);
-        if (chunkInfoIndex == -1)
-        {
-            return false;
-        }
-        chunkId = mChunkData[chunkInfoIndex].parentChunkId;
+        chunkInfoIndex = mChunkParents[chunkInfoIndex];
     }
-    return false;
+    return chunkInfoIndex == ancestorIndex && ancestorId != chunkId;
 }
 
 bool FractureToolImpl::deleteChunkSubhierarchy(int32_t chunkId, bool deleteRoot /*= false*/)
 {
-    std::vector<int32_t> chunkToDelete;
-    for (uint32_t i = 0; i < mChunkData.size(); ++i)
+    const int32_t rootIndex = getChunkInfoIndex(chunkId);
+    if (rootIndex == -1)
     {
-        if (isAncestorForChunk(chunkId, mChunkData[i].chunkId) || (deleteRoot && chunkId == mChunkData[i].chunkId))
-        {
-            chunkToDelete.push_back(i);
-        }
+        return false;
     }
-    for (int32_t i = (int32_t)chunkToDelete.size() - 1; i >= 0; --i)
+
+    // Subhierarchy in breadth first order, removed backwards so that children go before their parents
+    std::vector<uint32_t> chunkToDelete(1, rootIndex);
+    for (uint32_t i = 0; i < chunkToDelete.size(); ++i)
     {
-        int32_t m = chunkToDelete[i];
-        delete mChunkData[m].getMesh();
-        std::swap(mChunkData.back(), mChunkData[m]);
-        mChunkData.pop_back();
+        const std::vector<uint32_t>& children = mChunkChildren[chunkToDelete[i]];
+        chunkToDelete.insert(chunkToDelete.end(), children.begin(), children.end());
     }
-    markLeaves();
-    return chunkToDelete.size() > 0;
+    const uint32_t first = deleteRoot ? 0 : 1;
+    for (uint32_t i = (uint32_t)chunkToDelete.size(); i-- > first;)
+    {
+        mChunkMeshRefs.release(mChunkData[chunkToDelete[i]].getMesh());
+        removeChunkInfo(chunkToDelete[i]);
+    }
+    return chunkToDelete.size() > first;
 }
 
 void FractureToolImpl::finalizeFracturing()
 {
+    compactChunks();
+
     std::vector<Triangulator*> oldTriangulators = mChunkPostprocessors;
     std::map<int32_t, int32_t> chunkIdToTriangulator;
     std::set<uint32_t> newChunkMask;
@@ -1914,6 +2578,7 @@ void FractureToolImpl::finalizeFracturing()
     mChunkPostprocessors.resize(mChunkData.size());
     newChunkMask.insert(0xffffffff);  // To trigger masking mode, if newChunkMask will happen to be empty, all UVs will
                                       // be updated.
+    std::vector<uint32_t> changedChunks;
     for (uint32_t i = 0; i < mChunkPostprocessors.size(); ++i)
     {
 
@@ -1922,12 +2587,10 @@ void FractureToolImpl::finalizeFracturing()
         {
             if (it != chunkIdToTriangulator.end())
             {
-                delete oldTriangulators[it->second];
+                mChunkMeshRefs.release(oldTriangulators[it->second]);
                 oldTriangulators[it->second] = nullptr;
             }
-            mChunkPostprocessors[i] = new Triangulator();
-            mChunkPostprocessors[i]->triangulate(mChunkData[i].getMesh());
-            mChunkPostprocessors[i]->getParentChunkId() = mChunkData[i].chunkId;
+            changedChunks.push_back(i);
             newChunkMask.insert(mChunkData[i].chunkId);
             mChunkData[i].isChanged = false;
         }
@@ -1937,6 +2600,17 @@ void FractureToolImpl::finalizeFracturing()
         }
     }
 
+    /**
+    Changed chunks are triangulated on the calling thread: Triangulator isn't known to be free of shared state, so it
+    isn't run on workers.
+    */
+    for (uint32_t i : changedChunks)
+    {
+        mChunkPostprocessors[i] = new Triangulator();
+        mChunkPostprocessors[i]->triangulate(mChunkData[i].getMesh());
+        mChunkPostprocessors[i]->getParentChunkId() = mChunkData[i].chunkId;
+    }
+
     std::vector<int32_t> badOnes;
     for (uint32_t i = 0; i < mChunkPostprocessors.size(); ++i)
     {
@@ -1945,19 +2619,17 @@ void FractureToolImpl::finalizeFracturing()
             badOnes.push_back(i);
         }
     }
-    for (int32_t i = (int32_t)badOnes.size() - 1; i >= 0; --i)
+    for (int32_t badOne : badOnes)
     {
-        int32_t chunkId = mChunkData[badOnes[i]].chunkId;
-        for (uint32_t j = 0; j < mChunkData.size(); ++j)
+        const std::vector<uint32_t> children = mChunkChildren[badOne];
+        for (uint32_t child : children)
         {
-            if (mChunkData[j].parentChunkId == chunkId)
-                mChunkData[j].parentChunkId = mChunkData[badOnes[i]].parentChunkId;
+            setChunkParent(child, mChunkData[badOne].parentChunkId);
         }
-        std::swap(mChunkPostprocessors[badOnes[i]], mChunkPostprocessors.back());
-        mChunkPostprocessors.pop_back();
-        std::swap(mChunkData[badOnes[i]], mChunkData.back());
-        mChunkData.pop_back();
+        mChunkMeshRefs.release(mChunkData[badOne].getMesh());
+        removeChunkInfo(badOne);
     }
+    compactChunks();
     if (!mChunkPostprocessors.empty())  // Failsafe to prevent infinite loop (leading to stack overflow)
     {
         fitAllUvToRect(1.0f, newChunkMask);
@@ -2263,7 +2935,7 @@ int32_t FractureToolImpl::islandDetectionAndRemoving(int32_t chunkId, bool creat
             // We need to flag the chunk as changed, in case someone is calling this function directly
             // Otherwise when called as part of automatic island removal, chunks are already flagged as changed
             mChunkData[chunkInfoIndex].isChanged = true;
-            delete mChunkData[chunkInfoIndex].getMesh();
+            mChunkMeshRefs.release(mChunkData[chunkInfoIndex].getMesh());
             Mesh* newMesh0 =
                 new MeshImpl(compVertices[0].data(), compEdges[0].data(), compFacets[0].data(),
                              static_cast<uint32_t>(compVertices[0].size()), static_cast<uint32_t>(compEdges[0].size()),
@@ -2271,8 +2943,9 @@ int32_t FractureToolImpl::islandDetectionAndRemoving(int32_t chunkId, bool creat
             setChunkInfoMesh(mChunkData[chunkInfoIndex], newMesh0);
             for (int32_t i = 1; i < cComp; ++i)
             {
-                mChunkData.push_back(ChunkInfo(mChunkData[chunkInfoIndex]));
-                mChunkData.back().chunkId = createId();
+                ChunkInfo newChunk(mChunkData[chunkInfoIndex]);
+                newChunk.chunkId = createId();
+                addChunkInfo(newChunk);
                 Mesh* newMesh_i =
                     new MeshImpl(compVertices[i].data(), compEdges[i].data(), compFacets[i].data(),
                                  static_cast<uint32_t>(compVertices[i].size()),
@@ -2354,11 +3027,11 @@ int32_t FractureToolImpl::getInteriorMaterialId() const
 
 void FractureToolImpl::replaceMaterialId(int32_t oldMaterialId, int32_t newMaterialId)
 {
-    for (auto& chunkData : mChunkData)
+    for (uint32_t i = 0; i < mChunkData.size(); ++i)
     {
-        if (chunkData.getMesh())
+        if (mChunkData[i].getMesh())
         {
-            chunkData.getMesh()->replaceMaterialId(oldMaterialId, newMaterialId);
+            getWritableChunkMesh(i)->replaceMaterialId(oldMaterialId, newMaterialId);
         }
     }
 }
@@ -2378,7 +3051,7 @@ uint32_t FractureToolImpl::stretchGroup(const std::vector<uint32_t>& grp, std::v
 
     for (uint32_t i = 0; i < grp.size(); ++i)
     {
-        mChunkData[grp[i]].parentChunkId = mChunkData[newChunkIndex].chunkId;
+        setChunkParent(grp[i], mChunkData[newChunkIndex].chunkId);
 
         auto vr = mChunkData[grp[i]].getMesh()->getVertices();
         auto ed = mChunkData[grp[i]].getMesh()->getEdges();
@@ -2433,14 +3106,169 @@ uint32_t FractureToolImpl::stretchGroup(const std::vector<uint32_t>& grp, std::v
 }
 
 uint32_t FractureToolImpl::createNewChunk(uint32_t parentChunkId)
+{
+    ChunkInfo chunk;
+    chunk.parentChunkId = parentChunkId;
+    chunk.chunkId       = createId();
+    return addChunkInfo(chunk);
+}
+
+uint32_t FractureToolImpl::addChunkInfo(const ChunkInfo& chunkInfo)
 {
     const uint32_t index = static_cast<uint32_t>(mChunkData.size());
-    mChunkData.push_back(ChunkInfo());
-    mChunkData.back().parentChunkId = parentChunkId;
-    mChunkData.back().chunkId = createId();
+    mChunkData.push_back(chunkInfo);
+    mChunkData.back().isLeaf = true;
+    mChunkParents.push_back(-1);
+    mChunkDepths.push_back(0);
+    mChunkChildSlots.push_back(0);
+    mChunkChildren.push_back(std::vector<uint32_t>());
+    mChunkIndex[chunkInfo.chunkId] = index;
+    linkChunk(index);
     return index;
 }
 
+void FractureToolImpl::removeChunkInfo(uint32_t chunkInfoIndex)
+{
+    NVBLAST_ASSERT(mChunkChildren[chunkInfoIndex].empty());
+    unlinkChunk(chunkInfoIndex);
+    mChunkIndex.erase(mChunkData[chunkInfoIndex].chunkId);
+    mChunkIds.release(mChunkData[chunkInfoIndex].chunkId);
+    mChunkData[chunkInfoIndex]   = ChunkInfo();
+    mChunkDepths[chunkInfoIndex] = -1;
+    ++mRemovedChunkCount;
+}
+
+void FractureToolImpl::setChunkParent(uint32_t chunkInfoIndex, int32_t parentChunkId)
+{
+    unlinkChunk(chunkInfoIndex);
+    mChunkData[chunkInfoIndex].parentChunkId = parentChunkId;
+    linkChunk(chunkInfoIndex);
+
+    std::vector<uint32_t> subhierarchy(1, chunkInfoIndex);
+    for (uint32_t i = 0; i < subhierarchy.size(); ++i)
+    {
+        const uint32_t index = subhierarchy[i];
+        for (uint32_t child : mChunkChildren[index])
+        {
+            mChunkDepths[child] = mChunkDepths[index] + 1;
+            subhierarchy.push_back(child);
+        }
+    }
+}
+
+void FractureToolImpl::linkChunk(uint32_t chunkInfoIndex)
+{
+    const int32_t parentIndex      = getChunkInfoIndex(mChunkData[chunkInfoIndex].parentChunkId);
+    mChunkParents[chunkInfoIndex]  = parentIndex;
+    if (parentIndex == -1)
+    {
+        mChunkDepths[chunkInfoIndex]     = 0;
+        mChunkChildSlots[chunkInfoIndex] = 0;
+        return;
+    }
+    mChunkDepths[chunkInfoIndex]     = mChunkDepths[parentIndex] + 1;
+    mChunkChildSlots[chunkInfoIndex] = static_cast<uint32_t>(mChunkChildren[parentIndex].size());
+    mChunkChildren[parentIndex].push_back(chunkInfoIndex);
+    mChunkData[parentIndex].isLeaf = false;
+}
+
+void FractureToolImpl::unlinkChunk(uint32_t chunkInfoIndex)
+{
+    const int32_t parentIndex = mChunkParents[chunkInfoIndex];
+    if (parentIndex == -1)
+    {
+        return;
+    }
+    std::vector<uint32_t>& siblings = mChunkChildren[parentIndex];
+    const uint32_t slot             = mChunkChildSlots[chunkInfoIndex];
+    NVBLAST_ASSERT(siblings[slot] == chunkInfoIndex);
+    siblings[slot] = siblings.back();
+    siblings.pop_back();
+    if (slot < siblings.size())
+    {
+        mChunkChildSlots[siblings[slot]] = slot;
+    }
+    mChunkParents[chunkInfoIndex]  = -1;
+    mChunkData[parentIndex].isLeaf = siblings.empty();
+}
+
+void FractureToolImpl::compactChunks()
+{
+    if (mRemovedChunkCount == 0)
+    {
+        return;
+    }
+
+    // Chunks keep their order, triangulators of finalized chunks move with them
+    const uint32_t postprocessorCount = static_cast<uint32_t>(mChunkPostprocessors.size());
+    uint32_t chunkWriteIndex         = 0;
+    uint32_t postprocessorWriteIndex = 0;
+    for (uint32_t chunkReadIndex = 0; chunkReadIndex < mChunkData.size(); ++chunkReadIndex)
+    {
+        const bool removed = mChunkDepths[chunkReadIndex] < 0;
+        if (chunkReadIndex < postprocessorCount)
+        {
+            if (removed)
+            {
+                mChunkMeshRefs.release(mChunkPostprocessors[chunkReadIndex]);
+            }
+            else
+            {
+                mChunkPostprocessors[postprocessorWriteIndex++] = mChunkPostprocessors[chunkReadIndex];
+            }
+        }
+        if (!removed)
+        {
+            if (chunkReadIndex != chunkWriteIndex)
+            {
+                mChunkData[chunkWriteIndex] = mChunkData[chunkReadIndex];
+            }
+            ++chunkWriteIndex;
+        }
+    }
+    mChunkData.resize(chunkWriteIndex);
+    mChunkPostprocessors.resize(postprocessorWriteIndex);
+    mRemovedChunkCount = 0;
+    rebuildChunkIndex();
+}
+
+void FractureToolImpl::rebuildChunkIndex()
+{
+    const uint32_t chunkCount = static_cast<uint32_t>(mChunkData.size());
+    mChunkIndex.clear();
+    mChunkIndex.reserve(chunkCount);
+    for (uint32_t i = 0; i < chunkCount; ++i)
+    {
+        mChunkIndex[mChunkData[i].chunkId] = i;
+    }
+
+    mChunkParents.assign(chunkCount, -1);
+    mChunkDepths.assign(chunkCount, 0);
+    mChunkChildSlots.assign(chunkCount, 0);
+    mChunkChildren.assign(chunkCount, std::vector<uint32_t>());
+    std::vector<uint32_t> order;
+    for (uint32_t i = 0; i < chunkCount; ++i)
+    {
+        const int32_t parentIndex = getChunkInfoIndex(mChunkData[i].parentChunkId);
+        if (parentIndex == -1)
+        {
+            order.push_back(i);
+            continue;
+        }
+        mChunkParents[i]    = parentIndex;
+        mChunkChildSlots[i] = static_cast<uint32_t>(mChunkChildren[parentIndex].size());
+        mChunkChildren[parentIndex].push_back(i);
+    }
+    for (uint32_t i = 0; i < order.size(); ++i)
+    {
+        for (uint32_t child : mChunkChildren[order[i]])
+        {
+            mChunkDepths[child] = mChunkDepths[order[i]] + 1;
+            order.push_back(child);
+        }
+    }
+    markLeaves();
+}
 
 void FractureToolImpl::fitUvToRect(float side, uint32_t chunk)
 {
@@ -2456,6 +3284,7 @@ void FractureToolImpl::fitUvToRect(float side, uint32_t chunk)
     nvidia::NvBounds3 bnd;
     bnd.setEmpty();
 
+    mChunkPostprocessors[infoIndex] = mChunkMeshRefs.makeWritable(mChunkPostprocessors[infoIndex]);
     std::vector<Triangle>& ctrs   = mChunkPostprocessors[infoIndex]->getBaseMesh();
     std::vector<Triangle>& output = mChunkPostprocessors[infoIndex]->getBaseMesh();
 
@@ -2502,14 +3331,23 @@ void FractureToolImpl::fitAllUvToRect(float side, std::set<uint32_t>& mask)
     {
         return;  // We dont have triangulated chunks.
     }
-    nvidia::NvBounds3 bnd;
-    bnd.setEmpty();
-
-    for (uint32_t chunk = 0; chunk < mChunkData.size(); ++chunk)
+    /**
+    Interior UV bounds are reduced over workers: each worker bounds UVs of its chunks, worker bounds are united after.
+    Union of bounds doesn't depend on the order, so the result is the same as on a single thread.
+    */
+    const uint32_t chunkCount  = static_cast<uint32_t>(mChunkData.size());
+    uint32_t workerCount       = getParallelWorkerCount(mThreadCount, chunkCount);
+    std::vector<nvidia::NvBounds3> workerBounds(workerCount, nvidia::NvBounds3::empty());
+    parallelFor(workerCount, chunkCount, [&](uint32_t w, uint32_t chunk)
     {
-        Mesh* m                = mChunkData[chunk].getMesh();
+        const Mesh* m          = mChunkData[chunk].getMesh();
+        if (m == nullptr)
+        {
+            return;
+        }
         const Edge* edges      = m->getEdges();
         const Vertex* vertices = m->getVertices();
+        nvidia::NvBounds3& bnd = workerBounds[w];
 
         for (uint32_t trn = 0; trn < m->getFacetCount(); ++trn)
         {
@@ -2523,15 +3361,32 @@ void FractureToolImpl::fitAllUvToRect(float side, std::set<uint32_t>& mask)
                 bnd.include(NvVec3(vertices[v2].uv[0].x, vertices[v2].uv[0].y, 0.0f));
             }
         }
+    });
+    nvidia::NvBounds3 bnd;
+    bnd.setEmpty();
+    for (const nvidia::NvBounds3& bounds : workerBounds)
+    {
+        bnd.include(bounds);
     }
     float xscale = side / (bnd.maximum.x - bnd.minimum.x);
     float yscale = side / (bnd.maximum.y - bnd.minimum.y);
     xscale       = std::min(xscale, yscale);  // To have uniform scaling
 
+    // Shared triangulators are copied here, on the calling thread, then chunks are fitted on workers
+    std::vector<uint32_t> fittedChunks;
     for (uint32_t chunk = 0; chunk < mChunkPostprocessors.size(); ++chunk)
     {
         if (!mask.empty() && mask.find(mChunkPostprocessors[chunk]->getParentChunkId()) == mask.end())
             continue;
+        mChunkPostprocessors[chunk] = mChunkMeshRefs.makeWritable(mChunkPostprocessors[chunk]);
+        fittedChunks.push_back(chunk);
+    }
+
+    const uint32_t fittedCount = static_cast<uint32_t>(fittedChunks.size());
+    workerCount                = getParallelWorkerCount(mThreadCount, fittedCount);
+    parallelFor(workerCount, fittedCount, [&](uint32_t, uint32_t f)
+    {
+        const uint32_t chunk          = fittedChunks[f];
         std::vector<Triangle>& ctrs   = mChunkPostprocessors[chunk]->getBaseMeshNotFitted();
         std::vector<Triangle>& output = mChunkPostprocessors[chunk]->getBaseMesh();
 
@@ -2547,23 +3402,14 @@ void FractureToolImpl::fitAllUvToRect(float side, std::set<uint32_t>& mask)
             output[trn].b.uv[0].y = (ctrs[trn].b.uv[0].y - bnd.minimum.y) * xscale;
             output[trn].c.uv[0].y = (ctrs[trn].c.uv[0].y - bnd.minimum.y) * xscale;
         }
-    }
+    });
 }
 
 void FractureToolImpl::markLeaves()
 {
-    for (ChunkInfo& info : mChunkData)
-    {
-        info.isLeaf = true;
-    }
-
-    for (ChunkInfo& info : mChunkData)
+    for (uint32_t i = 0; i < mChunkData.size(); ++i)
     {
-        const int32_t infoIndex = getChunkInfoIndex(info.parentChunkId);
-        if (infoIndex >= 0)
-        {
-            mChunkData[infoIndex].isLeaf = false;
-        }
+        mChunkData[i].isLeaf = mChunkChildren[i].empty();
     }
 }
 
@@ -2663,6 +3509,20 @@ bool FractureToolImpl::setChunkInfoMesh(ChunkInfo& chunkInfo, Mesh* mesh, bool f
     return true;
 }
 
+Mesh* FractureToolImpl::getWritableChunkMesh(uint32_t chunkInfoIndex)
+{
+    // Class to access protected ChunkInfo members, transform stays the same for the copy
+    struct ChunkInfoAuth : public ChunkInfo
+    {
+        void setMeshData(Mesh* mesh) { meshData = mesh; }
+    };
+
+    ChunkInfo& chunkInfo = mChunkData[chunkInfoIndex];
+    Mesh* mesh           = mChunkMeshRefs.makeWritable(chunkInfo.getMesh());
+    static_cast<ChunkInfoAuth&>(chunkInfo).setMeshData(mesh);
+    return mesh;
+}
+
 void FractureToolImpl::rebuildAdjGraph(const std::vector<uint32_t>& chunks, const NvcVec2i* adjChunks,
                                        uint32_t adjChunksSize, std::vector<std::vector<uint32_t> >& chunkGraph)
 {
@@ -2831,20 +3691,23 @@ void FractureToolImpl::uniteChunks(uint32_t threshold, uint32_t targetClusterSiz
         }
 
         // Make all descendants mergable too
-        std::vector<int32_t> treeWalk;
-        for (uint32_t chunkInfoIndex = 0; chunkInfoIndex < mChunkData.size(); ++chunkInfoIndex)
+        std::vector<uint32_t> treeWalk;
+        for (uint32_t chunkN = 0; chunkN < mergeChunkCount; ++chunkN)
+        {
+            treeWalk.push_back(chunksToMerge[chunkN]);
+        }
+        while (!treeWalk.empty())
         {
-            treeWalk.clear();
-            int32_t walkInfoIndex = (int32_t)chunkInfoIndex;
-            do
+            const uint32_t walkInfoIndex = treeWalk.back();
+            treeWalk.pop_back();
+            for (uint32_t child : mChunkChildren[walkInfoIndex])
             {
-                if (chunkFlags[walkInfoIndex] & Mergeable)
+                if ((chunkFlags[child] & Mergeable) == 0)
                 {
-                    std::for_each(treeWalk.begin(), treeWalk.end(), [&chunkFlags](int32_t index) {chunkFlags[index] |= Mergeable; });
-                    break;
+                    chunkFlags[child] |= Mergeable;
+                    treeWalk.push_back(child);
                 }
-                treeWalk.push_back(walkInfoIndex);
-            } while ((walkInfoIndex = getChunkInfoIndex(mChunkData[walkInfoIndex].parentChunkId)) >= 0);
+            }
         }
     }
 
@@ -2852,11 +3715,9 @@ void FractureToolImpl::uniteChunks(uint32_t threshold, uint32_t targetClusterSiz
 
     for (uint32_t i = 0; i < mChunkData.size(); ++i)
     {
-        if (mChunkData[i].parentChunkId != -1)
-            childNumber[getChunkInfoIndex(mChunkData[i].parentChunkId)]++;
-        depth[i] = getChunkDepth(mChunkData[i].chunkId);
-        NVBLAST_ASSERT(depth[i] >= 0);
-        maxDepth = std::max(maxDepth, depth[i]);
+        childNumber[i] = static_cast<uint32_t>(mChunkChildren[i].size());
+        depth[i]       = mChunkDepths[i];
+        maxDepth       = std::max(maxDepth, depth[i]);
     }
 
     for (int32_t level = maxDepth; level > 0; --level)  // go from leaves to trunk and rebuild hierarchy
@@ -2942,39 +3803,20 @@ void FractureToolImpl::uniteChunks(uint32_t threshold, uint32_t targetClusterSiz
         }
     }
 
-    // Remove chunks
-    std::vector<uint32_t> remap(mChunkData.size(), 0xFFFFFFFF);
-    std::sort(chunksToRemove.begin(), chunksToRemove.end());
-    std::vector<uint32_t>::iterator removeIt = chunksToRemove.begin();
-    size_t chunkWriteIndex = 0;
-    for (size_t chunkReadIndex = 0; chunkReadIndex < mChunkData.size(); ++chunkReadIndex)
+    // Remove chunks, their children are moved to their parents. Slots are left until compactChunks().
+    for (uint32_t chunk : chunksToRemove)
     {
-        if (removeIt < chunksToRemove.end())
-        {
-            if (*removeIt == chunkReadIndex)
-            {
-                ++removeIt;
-                continue;
-            }
-        }
-        if (chunkReadIndex != chunkWriteIndex)
+        if (mChunkDepths[chunk] < 0)
         {
-            mChunkData[chunkWriteIndex] = mChunkData[chunkReadIndex];
+            continue;
         }
-        remap[chunkReadIndex] = chunkWriteIndex++;
-    }
-    mChunkData.resize(chunkWriteIndex);
-    for (ChunkInfo& chunkInfo : mChunkData)
-    {
-        if (chunkInfo.parentChunkId >= 0)
+        const std::vector<uint32_t> children = mChunkChildren[chunk];
+        for (uint32_t child : children)
         {
-            const uint32_t mappedParentIndex = remap[getChunkInfoIndex(chunkInfo.parentChunkId)];
-            NVBLAST_ASSERT(mappedParentIndex < mChunkData.size());
-            if (mappedParentIndex < mChunkData.size())
-            {
-                chunkInfo.parentChunkId = mChunkData[mappedParentIndex].chunkId;
-            }
+            setChunkParent(child, mChunkData[chunk].parentChunkId);
         }
+        mChunkMeshRefs.release(mChunkData[chunk].getMesh());
+        removeChunkInfo(chunk);
     }
 }
 
@@ -2999,35 +3841,20 @@ bool FractureToolImpl::setApproximateBonding(uint32_t chunkIndex, bool useApprox
 
 int32_t FractureToolImpl::createId()
 {
-    // make sure there is a free ID to be returned
-    if (mChunkIdsUsed.size() >= (size_t)INT32_MAX + 1)
+    const int32_t id = mChunkIds.create();
+    if (id < 0)
     {
         NvBlastGlobalGetErrorCallback()->reportError(nvidia::NvErrorCode::eINTERNAL_ERROR, "Chunk IDs exhausted.", __FILE__, __LINE__);
-        return -1;
-    }
-
-    // find the next free ID
-    while (mChunkIdsUsed.count(mNextChunkId))
-    {
-        // handle wrapping
-        if (++mNextChunkId < 0)
-            mNextChunkId = 0;
     }
-
-    // step the counter and handle wrapping
-    const int32_t id = mNextChunkId++;
-    if (mNextChunkId < 0)
-        mNextChunkId = 0;
-
-    return (reserveId(id) ? id : -1);
+    return id;
 }
 
 bool FractureToolImpl::reserveId(int32_t id)
 {
-    // add it to the used set and make sure it wasn't already in there
-    const auto ret = mChunkIdsUsed.insert(id);
-    NVBLAST_ASSERT_WITH_MESSAGE(ret.second, "Request to reserve ID, but it is already in use");
-    return ret.second;
+    // mark it used and make sure it wasn't already
+    const bool reserved = mChunkIds.reserve(id);
+    NVBLAST_ASSERT_WITH_MESSAGE(reserved, "Request to reserve ID, but it is already in use");
+    return reserved;
 }
 
 
@@ -3052,6 +3879,111 @@ void FractureToolImpl::getCracks(void* data)
     }
 }
 
+void FractureToolImpl::setThreadCount(uint32_t threadCount)
+{
+    mThreadCount = threadCount;
+}
+
+void FractureToolImpl::setNeighborSearch(VoronoiNeighborSearch::Enum method)
+{
+    mNeighborSearch = method;
+}
+
+uint32_t FractureToolImpl::snapshot()
+{
+    Snapshot* snapshot           = new Snapshot();
+    snapshot->planeIndexerOffset = mPlaneIndexerOffset;
+    snapshot->chunkIds           = mChunkIds;
+    snapshot->interiorMaterialId = mInteriorMaterialId;
+    snapshot->crackEdges         = mCrackEdges;
+    snapshot->lastCrackIndex     = mLastCrackIndex;
+
+    // Removed slots are dropped, triangulators stay aligned with their chunks
+    snapshot->chunkData.reserve(mChunkData.size() - mRemovedChunkCount);
+    for (uint32_t i = 0; i < mChunkData.size(); ++i)
+    {
+        if (mChunkDepths[i] < 0)
+        {
+            continue;
+        }
+        snapshot->chunkData.push_back(mChunkData[i]);
+        mChunkMeshRefs.acquire(mChunkData[i].getMesh());
+        if (i < mChunkPostprocessors.size())
+        {
+            snapshot->chunkPostprocessors.push_back(mChunkPostprocessors[i]);
+            mChunkMeshRefs.acquire(mChunkPostprocessors[i]);
+        }
+    }
+
+    for (uint32_t id = 0; id < mSnapshots.size(); ++id)
+    {
+        if (mSnapshots[id] == nullptr)
+        {
+            mSnapshots[id] = snapshot;
+            return id;
+        }
+    }
+    mSnapshots.push_back(snapshot);
+    return static_cast<uint32_t>(mSnapshots.size()) - 1;
+}
+
+bool FractureToolImpl::restore(uint32_t snapshotId)
+{
+    if (snapshotId >= mSnapshots.size() || mSnapshots[snapshotId] == nullptr)
+    {
+        return false;
+    }
+    const Snapshot& snapshot = *mSnapshots[snapshotId];
+
+    // Saved meshes and triangulators are acquired first, so the ones shared with current state are not deleted
+    for (const ChunkInfo& chunk : snapshot.chunkData)
+    {
+        mChunkMeshRefs.acquire(chunk.getMesh());
+    }
+    for (Triangulator* triangulator : snapshot.chunkPostprocessors)
+    {
+        mChunkMeshRefs.acquire(triangulator);
+    }
+    for (Triangulator* triangulator : mChunkPostprocessors)
+    {
+        mChunkMeshRefs.release(triangulator);
+    }
+    for (const ChunkInfo& chunk : mChunkData)
+    {
+        mChunkMeshRefs.release(chunk.getMesh());
+    }
+
+    mChunkData           = snapshot.chunkData;
+    mChunkPostprocessors = snapshot.chunkPostprocessors;
+    mPlaneIndexerOffset  = snapshot.planeIndexerOffset;
+    mChunkIds            = snapshot.chunkIds;
+    mInteriorMaterialId  = snapshot.interiorMaterialId;
+    mCrackEdges          = snapshot.crackEdges;
+    mLastCrackIndex      = snapshot.lastCrackIndex;
+    mRemovedChunkCount   = 0;
+    rebuildChunkIndex();
+    return true;
+}
+
+void FractureToolImpl::releaseSnapshot(uint32_t snapshotId)
+{
+    if (snapshotId >= mSnapshots.size() || mSnapshots[snapshotId] == nullptr)
+    {
+        return;
+    }
+    Snapshot* snapshot = mSnapshots[snapshotId];
+    for (Triangulator* triangulator : snapshot->chunkPostprocessors)
+    {
+        mChunkMeshRefs.release(triangulator);
+    }
+    for (const ChunkInfo& chunk : snapshot->chunkData)
+    {
+        mChunkMeshRefs.release(chunk.getMesh());
+    }
+    delete snapshot;
+    mSnapshots[snapshotId] = nullptr;
+}
+
 
 }  // namespace Blast
 }  // namespace Nv
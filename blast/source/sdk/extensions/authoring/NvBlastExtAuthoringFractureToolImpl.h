@@ -29,8 +29,11 @@
 
 #include "NvBlastExtAuthoringFractureTool.h"
 #include "NvBlastExtAuthoringMesh.h"
+#include "NvBlastExtAuthoringChunkIdAllocator.h"
+#include "NvBlastExtAuthoringChunkMeshRefs.h"
 #include <vector>
 #include <set>
+#include <unordered_map>
 
 namespace Nv
 {
@@ -39,6 +42,9 @@ namespace Blast
 
 class SpatialAccelerator;
 class Triangulator;
+class PointInMeshClassifier;
+class OccupancyGrid;
+class NoiseSurfaceCache;
 
 
 /**
@@ -138,13 +144,74 @@ public:
     */
     void                        blastPattern(const BlastConfiguration conf) override;
 
+    /**
+        # UNITY EXTENSION FUNCTIONS
+        Set algorithm used to find neighbors of generated sites
+    */
+    void                        setNeighborSearch(VoronoiNeighborSearch::Enum method) override;
+
+    /**
+        # UNITY EXTENSION FUNCTIONS
+        Get algorithm used to find neighbors of generated sites
+    */
+    VoronoiNeighborSearch::Enum getNeighborSearch() const override;
+
+    /**
+        # UNITY EXTENSION FUNCTIONS
+        Neighbor graph of current sites, see findCellBasePlanes. It is computed on first request and reused
+        until sites, neighbor search method or site scale change.
+        \param[out] neighborCount   Number of neighbor pairs
+        \param[in]  threadCount     Number of threads used if graph has to be computed
+        \param[in]  siteScale       Scale of the chunk the sites are used for, see findCellBasePlanes
+    */
+    const std::vector<std::vector<std::pair<int32_t, int32_t>>>& getNeighbors(int32_t& neighborCount, uint32_t threadCount = 1,
+                                                                              float siteScale = 1.0f);
+
+    /**
+        # UNITY EXTENSION FUNCTIONS
+        Neighbor graph of current sites in CSR form, neighbors of site i are neighbors[offsets[i]] .. neighbors[offsets[i + 1] - 1].
+        Buffers are owned by generator and stay valid until sites or neighbor search method change.
+        \param[out] offsets     Pointer to getVoronoiSites() + 1 offsets
+        \param[out] neighbors   Pointer to neighbor site indices, each pair is stored for both sites
+        \return                 Number of neighbor pairs
+    */
+    int32_t                     getNeighborsCSR(const int32_t*& offsets, const int32_t*& neighbors);
+
 
 private:
+    /**
+        Point is inside of the fracture mesh and of the stencil mesh if it is set
+    */
+    bool                        isPointInside(const NvcVec3& point);
+
+    /**
+        Occupancy grid of mesh and stencil, built on first use and dropped when mesh or stencil changes
+    */
+    const OccupancyGrid&        getOccupancyGrid();
+
+    /**
+        Recomputes neighbor graph if sites, neighbor search method or site scale changed since it was computed
+    */
+    void                        updateNeighbors(uint32_t threadCount, float siteScale);
+
     std::vector <NvcVec3>   mGeneratedSites;
     const Mesh*                 mMesh;
     const Mesh*                 mStencil;
     RandomGeneratorBase*        mRnd;
-    SpatialAccelerator*         mAccelerator;
+    PointInMeshClassifier*      mClassifier;
+    PointInMeshClassifier*      mStencilClassifier;
+    OccupancyGrid*              mOccupancy;
+    VoronoiNeighborSearch::Enum mNeighborSearch;
+
+    /* Neighbor graph cache, valid for mNeighborSites, mNeighborSitesSearch and mNeighborSiteScale */
+    bool                        mNeighborsValid;
+    std::vector<NvcVec3>        mNeighborSites;
+    VoronoiNeighborSearch::Enum mNeighborSitesSearch;
+    float                       mNeighborSiteScale;
+    std::vector<std::vector<std::pair<int32_t, int32_t>>> mNeighbors;
+    int32_t                     mNeighborCount;
+    std::vector<int32_t>        mNeighborOffsets;
+    std::vector<int32_t>        mNeighborIndices;
 };
 
 
@@ -160,7 +227,9 @@ public:
     /**
         FractureTool can log asset creation info if logCallback is provided.
     */
-    FractureToolImpl() : mRemoveIslands(false)
+    FractureToolImpl()
+    : mRemovedChunkCount(0), mRemoveIslands(false), mThreadCount(1), mNeighborSearch(VoronoiNeighborSearch::HALFSPACE_TEST),
+      mNoiseSurfaces(nullptr)
     {
         reset();
     }
@@ -168,6 +237,10 @@ public:
     ~FractureToolImpl()
     {
         reset();
+        for (uint32_t i = 0; i < mSnapshots.size(); ++i)
+        {
+            releaseSnapshot(i);
+        }
     }
 
     void                                    release() override;
@@ -237,6 +310,22 @@ public:
     */
     int32_t                                 voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const NvcVec3* cellPoints, const NvcVec3& scale, const NvcQuat& rotation, bool replaceChunk) override;
 
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Fractures specified chunk with voronoi method using precomputed cell neighbors.
+        Neighbors found for sites in world space are valid in chunk space, chunk transform is uniform scale and translation,
+        if they were searched with the chunk scale as siteScale, see findCellBasePlanes.
+        \param[in] chunkId              Chunk to fracture
+        \param[in] cellPoints           Array of voronoi sites
+        \param[in] neighbors            Cell neighbors of cellPoints, see findCellBasePlanes
+        \param[in] neighborCount        Number of neighbor pairs returned by findCellBasePlanes
+        \param[in] replaceChunk         if 'true', newly generated chunks will replace source chunk
+        \return   If 0, fracturing is successful.
+    */
+    int32_t                                 voronoiFracturing(uint32_t chunkId, uint32_t cellCount, const NvcVec3* cellPoints,
+                                                              const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors,
+                                                              int32_t neighborCount, bool replaceChunk);
+
 
     /**
         Fractures specified chunk with slicing method.
@@ -285,6 +374,11 @@ public:
     
     uint32_t                                getChunkCount() const override;
 
+    /**
+        Drop slots of removed chunks. Chunk indices change, chunk IDs don't.
+    */
+    void                                    compactChunks() override;
+
     /**
         Get chunk information
     */
@@ -347,6 +441,14 @@ public:
     */
     uint32_t                                getChunksIdAtDepth(uint32_t depth, int32_t*& chunkIds) const override;
 
+    /**
+        Iterate chunk IDs with given depth without allocation.
+        \param[in]      depth   Chunk depth
+        \param[in,out]  cursor  Iteration state, set to 0 before the first call
+        \return Next chunk ID at depth, -1 if there are no more chunks.
+    */
+    int32_t                                 getNextChunkIdAtDepth(uint32_t depth, uint32_t& cursor) const override;
+
 
     /**
         Get result geometry without noise as vertex and index buffers, where index buffers contain series of triplets
@@ -416,6 +518,61 @@ public:
     */
     void                                    getCracks(void* data) override;
 
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Set number of worker threads used for fracturing. Results do not depend on the thread count.
+        \param[in] threadCount Number of threads, 0 - one per hardware core, 1 - run on calling thread only (default)
+    */
+    void                                    setThreadCount(uint32_t threadCount) override;
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Set algorithm used to find voronoi cell neighbors in voronoiFracturing.
+    */
+    void                                    setNeighborSearch(VoronoiNeighborSearch::Enum method) override;
+
+    VoronoiNeighborSearch::Enum             getNeighborSearch() const { return mNeighborSearch; }
+    uint32_t                                getThreadCount() const { return mThreadCount; }
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Fractures several chunks with voronoi method, each chunk with its own sites. Chunks are processed concurrently,
+        new chunks are committed in the order of chunkIds, so results don't depend on thread count.
+        Chunks with invalid input (unknown or repeated id, less than 2 sites, chunk 0 with replaceChunk) are skipped.
+        \param[in] chunkCount           Number of chunks to fracture
+        \param[in] chunkIds             Chunks to fracture
+        \param[in] cellCounts           Number of sites of each chunk
+        \param[in] cellPoints           Sites of all chunks, sites of chunk i follow sites of chunk i - 1
+        \param[in] replaceChunk         if 'true', newly generated chunks will replace source chunks
+        \return   If 0, all chunks were fractured successfully, 1 if some chunks were skipped.
+    */
+    int32_t                                 voronoiFracturingBatch(uint32_t chunkCount, const uint32_t* chunkIds, const uint32_t* cellCounts,
+                                                                   const NvcVec3* cellPoints, bool replaceChunk) override;
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Save chunks with their meshes and triangulators, crack edges, chunk ID and plane index state and interior
+        material. Snapshot shares meshes and triangulators with the tool, each side copies one only when it changes it.
+        Snapshots belong to the tool, they are kept over reset() and released with the tool.
+        \return   Snapshot ID
+    */
+    uint32_t                                snapshot();
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Replace fracture state by the saved one, snapshot is kept and can be restored again. Removed chunk slots are
+        not saved, so chunk indices can differ from those at snapshot() time, chunk IDs are the same.
+        \param[in] snapshotId   Snapshot ID returned by snapshot()
+        \return   false if there is no such snapshot
+    */
+    bool                                    restore(uint32_t snapshotId);
+
+    /**
+        *UNITY EXTENSION FUNCTIONS*
+        Release snapshot, its meshes and triangulators are deleted unless the tool or other snapshots use them.
+    */
+    void                                    releaseSnapshot(uint32_t snapshotId);
+
 private:    
     bool                                    isAncestorForChunk(int32_t ancestorId, int32_t chunkId);
     int32_t                                 slicingNoisy(uint32_t chunkId, const SlicingConfiguration& conf, bool replaceChunk, RandomGeneratorBase* rnd);
@@ -436,11 +593,41 @@ private:
      */
     bool                                    setChunkInfoMesh(ChunkInfo& chunkInfo, Mesh* mesh, bool fromTransformed = true);
 
+    /**
+        Mesh of chunk which can be written in place. If the mesh is shared, the chunk takes its own copy first.
+    */
+    Mesh*                                   getWritableChunkMesh(uint32_t chunkInfoIndex);
+
     /**
         Returns newly created chunk index in mChunkData.
     */
     uint32_t                                createNewChunk(uint32_t parentChunkId);
 
+    /**
+        Append chunk info to mChunkData, index its chunk ID and add it to children of its parent, which must exist
+        already. New chunk is a leaf, its parent is not. Returns its index in mChunkData.
+    */
+    uint32_t                                addChunkInfo(const ChunkInfo& chunkInfo);
+
+    /**
+        Remove chunk info without children, its slot is left as a tombstone. Parent becomes a leaf if it has no other
+        children. Chunk ID is released, chunk mesh is not deleted.
+    */
+    void                                    removeChunkInfo(uint32_t chunkInfoIndex);
+
+    /**
+        Move chunk with its subhierarchy under another parent, depths of the subhierarchy are updated.
+    */
+    void                                    setChunkParent(uint32_t chunkInfoIndex, int32_t parentChunkId);
+
+    /**
+        Rebuild chunk ID index, hierarchy and leaf flags of mChunkData without tombstones.
+    */
+    void                                    rebuildChunkIndex();
+
+    void                                    linkChunk(uint32_t chunkInfoIndex);
+    void                                    unlinkChunk(uint32_t chunkInfoIndex);
+
     /**
      * Returns a previously unused ID.
      */
@@ -450,14 +637,81 @@ private:
      */
     bool                                    reserveId(int32_t id);
 
+    /**
+        Builds voronoi cells and intersects them with chunk mesh. Cells are processed on worker threads,
+        results are stored by cell index so that caller can commit them in the same order as serial code does.
+        \param[in]  mesh            Chunk mesh, cell points should be in the same space
+        \param[in]  cellPoints      Voronoi sites
+        \param[in]  neighbors       Cell neighbors, see findCellBasePlanes
+        \param[in]  scale           Optional cell scale, cells are scaled and rotated before intersection if not nullptr
+        \param[in]  rotation        Cell rotation, used only together with scale
+        \param[out] cellMeshes      Intersection result for each cell, nullptr if cell doesn't intersect the mesh
+        \param[out] cellCrackEdges  Optional crack edges produced by each cell intersection
+    */
+    void                                    buildVoronoiCells(const Mesh* mesh, const std::vector<NvcVec3>& cellPoints,
+                                                              const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors,
+                                                              const NvcVec3* scale, const NvcQuat* rotation,
+                                                              std::vector<Mesh*>& cellMeshes,
+                                                              std::vector<std::vector<std::pair<Vertex, Vertex>>>* cellCrackEdges);
+
+    /**
+        Voronoi cells of one chunk, input and output of batched buildVoronoiCells.
+    */
+    struct VoronoiChunkJob
+    {
+        const Mesh*                                                     mesh;
+        const std::vector<NvcVec3>*                                     cellPoints;
+        const std::vector<std::vector<std::pair<int32_t, int32_t>>>*    neighbors;
+        int64_t                                                         planeIndexerOffset;
+        std::vector<Mesh*>                                              cellMeshes;
+        std::vector<std::vector<std::pair<Vertex, Vertex>>>             cellCrackEdges;
+    };
+
+    /**
+        Builds voronoi cells of several chunks. Cells of all chunks are distributed over the same workers,
+        each worker rebuilds its accelerator only when it moves to the next chunk.
+        \param[in,out] jobs                Chunks to process, cellMeshes and cellCrackEdges are filled for each
+        \param[in]     scale               Optional cell scale, see single chunk version
+        \param[in]     rotation            Cell rotation, used only together with scale
+        \param[in]     collectCrackEdges   Fill cellCrackEdges of jobs
+    */
+    void                                    buildVoronoiCells(std::vector<VoronoiChunkJob>& jobs, const NvcVec3* scale,
+                                                              const NvcQuat* rotation, bool collectCrackEdges);
+
 protected:
     /* Chunk mesh wrappers */
     std::vector<Triangulator*>          mChunkPostprocessors;
 
     int64_t                             mPlaneIndexerOffset;
-    int32_t                             mNextChunkId;
-    std::set<int32_t>                   mChunkIdsUsed;
+    ChunkIdAllocator                    mChunkIds;
+    /**
+        Chunk slots. Slots are stable: removed chunks leave tombstones (ChunkInfo with chunkId -1 and no mesh) until
+        compactChunks(). Hierarchy of slot i is kept in the arrays below, so hierarchy walks don't touch ChunkInfo.
+    */
     std::vector<ChunkInfo>              mChunkData;
+    std::unordered_map<int32_t, uint32_t>   mChunkIndex;        // Chunk ID -> slot
+    std::vector<int32_t>                mChunkParents;      // Parent slot, -1 if there is no parent chunk
+    std::vector<int32_t>                mChunkDepths;       // -1 for removed chunks
+    std::vector<uint32_t>               mChunkChildSlots;   // Position in children of parent
+    std::vector<std::vector<uint32_t> > mChunkChildren;     // Child slots
+    uint32_t                            mRemovedChunkCount;
+    ChunkMeshRefs                       mChunkMeshRefs;     // Chunk meshes can be shared, see getWritableChunkMesh(...)
+
+    /**
+        Fracture state saved by snapshot(), without removed chunk slots. Meshes and triangulators are owned through
+        mChunkMeshRefs, chunk postprocessors are aligned with chunk data as in the tool.
+    */
+    struct Snapshot
+    {
+        std::vector<ChunkInfo>                  chunkData;
+        std::vector<Triangulator*>              chunkPostprocessors;
+        int64_t                                 planeIndexerOffset;
+        ChunkIdAllocator                        chunkIds;
+        int32_t                                 interiorMaterialId;
+        std::vector<std::pair<Vertex, Vertex>>  crackEdges;
+        int32_t                                 lastCrackIndex;
+    };
+    std::vector<Snapshot*>              mSnapshots;         // Indexed by snapshot ID, nullptr for released ones
 
     bool                                mRemoveIslands;
     int32_t                             mInteriorMaterialId;
@@ -465,10 +719,40 @@ protected:
     /* Unity Extensions */
     std::vector<std::pair<Vertex, Vertex>>  mCrackEdges;
     int32_t                                 mLastCrackIndex;
+    uint32_t                                mThreadCount;
+    VoronoiNeighborSearch::Enum             mNeighborSearch;
+
+    /* Noise heightfields of noisy cuts, shared between slices and operations */
+    NoiseSurfaceCache*                      mNoiseSurfaces;
 };
 
-int32_t findCellBasePlanes(const std::vector<NvcVec3>& sites, std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors);
-Mesh* getCellMesh(class BooleanEvaluator& eval, int32_t planeIndexerOffset, int32_t cellId, const std::vector<NvcVec3>& sites, const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors, int32_t interiorMaterialId, NvcVec3 origin);
+/**
+    Finds neighbor cells of voronoi sites and assigns global index to each pair of neighbors.
+    Pairs (i, j), i < j, are indexed in ascending order of i then j, each pair is stored in both neighbors[i] and neighbors[j].
+    \param[in]  sites       Voronoi sites
+    \param[out] neighbors   For each site list of (neighbor site, pair index)
+    \param[in]  method      Neighbor search algorithm
+    \param[in]  threadCount Number of threads used by VoronoiNeighborSearch::SECURITY_RADIUS, 0 - one per hardware core
+    \param[in]  siteScale   Size of chunk space unit in site units. VoronoiNeighborSearch::SECURITY_RADIUS bounds cells
+                            by max(SITE_BOX_SIZE * siteScale, sites bounds diagonal), cells are built in a box of
+                            SITE_BOX_SIZE in chunk space, so chunk scale should be passed for world space sites.
+    \return                 Number of neighbor pairs
+*/
+int32_t findCellBasePlanes(const std::vector<NvcVec3>& sites, std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors,
+                           VoronoiNeighborSearch::Enum method = VoronoiNeighborSearch::HALFSPACE_TEST, uint32_t threadCount = 1,
+                           float siteScale = 1.0f);
+/**
+    Builds voronoi cell polytope by clipping box of SITE_BOX_SIZE around origin with bisector planes of cell neighbors.
+    Faces userData store plane index, it is negative for the cell with greater index.
+    \param[in] cell    Scratch polytope, can be reused between calls
+    \return false if cell is empty
+*/
+bool buildCell(class ConvexCell& cell, int32_t planeIndexerOffset, int32_t cellId, const std::vector<NvcVec3>& sites, const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors, NvcVec3 origin);
+/**
+    Mesh of the cell built by buildCell(...).
+    \return nullptr if cell is empty
+*/
+Mesh* getCellMesh(class ConvexCell& cell, int32_t planeIndexerOffset, int32_t cellId, const std::vector<NvcVec3>& sites, const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors, int32_t interiorMaterialId, NvcVec3 origin);
 
 } // namespace Blast
 } // namespace Nv
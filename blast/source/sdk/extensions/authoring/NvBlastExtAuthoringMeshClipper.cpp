@@ -0,0 +1,560 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+#include "NvBlastExtAuthoringMeshClipper.h"
+#include "NvBlastExtAuthoringMeshImpl.h"
+#include "NvBlastGlobals.h"
+#include <algorithm>
+#include <stdint.h>
+#include <math.h>
+
+namespace Nv
+{
+namespace Blast
+{
+
+void getPlaneBasis(const double n[3], double u[3], double v[3])
+{
+    if (fabs(n[0]) < 0.6)
+    {
+        u[0] = 0.0, u[1] = n[2], u[2] = -n[1];
+    }
+    else
+    {
+        u[0] = -n[2], u[1] = 0.0, u[2] = n[0];
+    }
+    const double ul = sqrt(u[0] * u[0] + u[1] * u[1] + u[2] * u[2]);
+    u[0] /= ul;
+    u[1] /= ul;
+    u[2] /= ul;
+    v[0] = n[1] * u[2] - n[2] * u[1];
+    v[1] = n[2] * u[0] - n[0] * u[2];
+    v[2] = n[0] * u[1] - n[1] * u[0];
+}
+
+void ClipPlane::init(const NvcVec3& normal, const NvcVec3& point, int64_t userDataValue, int32_t materialIdValue)
+{
+    const double length = sqrt((double)normal.x * normal.x + (double)normal.y * normal.y + (double)normal.z * normal.z);
+    n[0] = normal.x / length;
+    n[1] = normal.y / length;
+    n[2] = normal.z / length;
+    d    = -(n[0] * point.x + n[1] * point.y + n[2] * point.z);
+    getPlaneBasis(n, u, v);
+    capNormal  = { (float)n[0], (float)n[1], (float)n[2] };
+    userData   = userDataValue;
+    materialId = materialIdValue;
+}
+
+NV_FORCE_INLINE double getDistance(const ClipPlane& plane, const NvcVec3& p)
+{
+    return plane.n[0] * p.x + plane.n[1] * p.y + plane.n[2] * p.z + plane.d;
+}
+
+NV_FORCE_INLINE bool isLexicographicallyLess(const NvcVec3& a, const NvcVec3& b)
+{
+    return a.x < b.x || (a.x == b.x && (a.y < b.y || (a.y == b.y && a.z < b.z)));
+}
+
+void MeshClipper::Geometry::clear()
+{
+    vertices.clear();
+    edges.clear();
+    edgeIsCrack.clear();
+    facets.clear();
+    facetIsCap.clear();
+}
+
+void MeshClipper::Geometry::append(const Geometry& src)
+{
+    const uint32_t vertexOffset = static_cast<uint32_t>(vertices.size());
+    const int32_t edgeOffset    = static_cast<int32_t>(edges.size());
+    vertices.insert(vertices.end(), src.vertices.begin(), src.vertices.end());
+    for (const Edge& edge : src.edges)
+    {
+        edges.push_back({ edge.s + vertexOffset, edge.e + vertexOffset });
+    }
+    edgeIsCrack.insert(edgeIsCrack.end(), src.edgeIsCrack.begin(), src.edgeIsCrack.end());
+    for (Facet facet : src.facets)
+    {
+        facet.firstEdgeNumber += edgeOffset;
+        facets.push_back(facet);
+    }
+    facetIsCap.insert(facetIsCap.end(), src.facetIsCap.begin(), src.facetIsCap.end());
+}
+
+Mesh* MeshClipper::Geometry::createMesh() const
+{
+    if (facets.empty())
+    {
+        return nullptr;
+    }
+    return new MeshImpl(vertices.data(), edges.data(), facets.data(), static_cast<uint32_t>(vertices.size()),
+                        static_cast<uint32_t>(edges.size()), static_cast<uint32_t>(facets.size()));
+}
+
+void MeshClipper::setMesh(const Mesh* mesh)
+{
+    mCurrent.clear();
+    if (mesh == nullptr)
+    {
+        return;
+    }
+    mCurrent.vertices.assign(mesh->getVertices(), mesh->getVertices() + mesh->getVerticesCount());
+    mCurrent.edges.assign(mesh->getEdges(), mesh->getEdges() + mesh->getEdgesCount());
+    mCurrent.edgeIsCrack.assign(mesh->getEdgesCount(), 0);
+    mCurrent.facets.assign(mesh->getFacetsBuffer(), mesh->getFacetsBuffer() + mesh->getFacetCount());
+    mCurrent.facetIsCap.assign(mesh->getFacetCount(), 0);
+}
+
+void MeshClipper::classify(const ClipPlane& plane)
+{
+    mDistances.resize(mCurrent.vertices.size());
+    for (uint32_t i = 0; i < mCurrent.vertices.size(); ++i)
+    {
+        mDistances[i] = getDistance(plane, mCurrent.vertices[i].p);
+    }
+}
+
+bool MeshClipper::clip(const ClipPlane& plane)
+{
+    if (isEmpty())
+    {
+        return false;
+    }
+    classify(plane);
+    if (std::all_of(mDistances.begin(), mDistances.end(), [](double d) { return d <= 0.0; }))
+    {
+        return true;
+    }
+    buildPart(plane, true, mInside);
+    std::swap(mCurrent, mInside);
+    return !isEmpty();
+}
+
+void MeshClipper::split(const ClipPlane& plane, Mesh*& inside, Mesh*& outside)
+{
+    inside  = nullptr;
+    outside = nullptr;
+    if (isEmpty())
+    {
+        return;
+    }
+    classify(plane);
+    buildPart(plane, true, mInside);
+    buildPart(plane, false, mOutside);
+    inside  = mInside.createMesh();
+    outside = mOutside.createMesh();
+    std::swap(mCurrent, mInside);
+}
+
+void MeshClipper::partition(const ClipPlane* planes, uint32_t count, std::vector<Mesh*>& parts)
+{
+    parts.assign(count + 1, nullptr);
+    if (isEmpty())
+    {
+        return;
+    }
+    std::swap(mSource, mCurrent);
+    mCurrent.clear();
+    if (mParts.size() < count + 1)
+    {
+        mParts.resize(count + 1);
+    }
+    for (uint32_t i = 0; i <= count; ++i)
+    {
+        mParts[i].clear();
+    }
+
+    /**
+        Part of a vertex is the first plane it is inside of. Distances are the same as classify(...) gives, so every
+        vertex is on the same side of every plane as it would be in consecutive splits.
+    */
+    const uint32_t vertexCount = static_cast<uint32_t>(mSource.vertices.size());
+    mVertexPart.resize(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+        uint32_t part = 0;
+        while (part < count && getDistance(planes[part], mSource.vertices[i].p) > 0.0)
+        {
+            ++part;
+        }
+        mVertexPart[i] = part;
+    }
+
+    /**
+        Facet with all vertices in one part is not cut by any split, it is moved to its part. Other facets are outside
+        of all planes before their lowest part, they are bucketed by it with counting sort and clipped from that plane on.
+    */
+    const uint32_t facetCount = static_cast<uint32_t>(mSource.facets.size());
+    mVertexMap.assign(vertexCount, -1);
+    mCrossingOffsets.assign(count + 1, 0);
+    mFacetPart.resize(facetCount);
+    for (uint32_t f = 0; f < facetCount; ++f)
+    {
+        const Facet& facet = mSource.facets[f];
+        uint32_t minPart   = UINT32_MAX;
+        uint32_t maxPart   = 0;
+        for (uint32_t i = facet.firstEdgeNumber; i < facet.firstEdgeNumber + facet.edgesCount; ++i)
+        {
+            minPart = std::min(minPart, mVertexPart[mSource.edges[i].s]);
+            maxPart = std::max(maxPart, mVertexPart[mSource.edges[i].s]);
+        }
+        mFacetPart[f] = minPart < maxPart ? minPart : UINT32_MAX;
+        if (minPart < maxPart)
+        {
+            ++mCrossingOffsets[minPart + 1];
+            continue;
+        }
+        if (minPart > maxPart)
+        {
+            continue;
+        }
+        Geometry& dst        = mParts[minPart];
+        const uint32_t first = static_cast<uint32_t>(dst.edges.size());
+        for (uint32_t i = facet.firstEdgeNumber; i < facet.firstEdgeNumber + facet.edgesCount; ++i)
+        {
+            const Edge& edge = mSource.edges[i];
+            for (uint32_t vertex : { edge.s, edge.e })
+            {
+                if (mVertexMap[vertex] < 0)
+                {
+                    mVertexMap[vertex] = static_cast<int32_t>(dst.vertices.size());
+                    dst.vertices.push_back(mSource.vertices[vertex]);
+                }
+            }
+            dst.edges.push_back({ static_cast<uint32_t>(mVertexMap[edge.s]), static_cast<uint32_t>(mVertexMap[edge.e]) });
+            dst.edgeIsCrack.push_back(mSource.edgeIsCrack[i]);
+        }
+        Facet newFacet           = facet;
+        newFacet.firstEdgeNumber = static_cast<int32_t>(first);
+        dst.facets.push_back(newFacet);
+        dst.facetIsCap.push_back(mSource.facetIsCap[f]);
+    }
+    for (uint32_t i = 1; i <= count; ++i)
+    {
+        mCrossingOffsets[i] += mCrossingOffsets[i - 1];
+    }
+    mCrossingFacets.resize(mCrossingOffsets[count]);
+    for (uint32_t f = 0; f < facetCount; ++f)
+    {
+        if (mFacetPart[f] != UINT32_MAX)
+        {
+            mCrossingFacets[mCrossingOffsets[mFacetPart[f]]++] = f;
+        }
+    }
+
+    /**
+        Remainder outside of all planes so far is kept in current geometry. Crossing facets join it at their lowest
+        plane, source vertices keep their remainder vertex, so facets joining later stay connected to earlier ones.
+    */
+    mSourceMap.assign(vertexCount, -1);
+    mSourceMapped.clear();
+    for (uint32_t p = 0; p < count; ++p)
+    {
+        for (uint32_t k = p > 0 ? mCrossingOffsets[p - 1] : 0; k < mCrossingOffsets[p]; ++k)
+        {
+            const Facet& facet   = mSource.facets[mCrossingFacets[k]];
+            const uint32_t first = static_cast<uint32_t>(mCurrent.edges.size());
+            for (uint32_t i = facet.firstEdgeNumber; i < facet.firstEdgeNumber + facet.edgesCount; ++i)
+            {
+                const Edge& edge = mSource.edges[i];
+                for (uint32_t vertex : { edge.s, edge.e })
+                {
+                    if (mSourceMap[vertex] < 0)
+                    {
+                        mSourceMap[vertex] = static_cast<int32_t>(mCurrent.vertices.size());
+                        mSourceMapped.push_back(vertex);
+                        mCurrent.vertices.push_back(mSource.vertices[vertex]);
+                    }
+                }
+                mCurrent.edges.push_back({ static_cast<uint32_t>(mSourceMap[edge.s]), static_cast<uint32_t>(mSourceMap[edge.e]) });
+                mCurrent.edgeIsCrack.push_back(mSource.edgeIsCrack[i]);
+            }
+            Facet newFacet           = facet;
+            newFacet.firstEdgeNumber = static_cast<int32_t>(first);
+            mCurrent.facets.push_back(newFacet);
+            mCurrent.facetIsCap.push_back(mSource.facetIsCap[mCrossingFacets[k]]);
+        }
+        if (isEmpty())
+        {
+            continue;
+        }
+
+        classify(planes[p]);
+        buildPart(planes[p], true, mInside);
+        mParts[p].append(mInside);
+        buildPart(planes[p], false, mOutside);
+        uint32_t kept = 0;
+        for (uint32_t vertex : mSourceMapped)
+        {
+            mSourceMap[vertex] = mVertexMap[mSourceMap[vertex]];
+            if (mSourceMap[vertex] >= 0)
+            {
+                mSourceMapped[kept++] = vertex;
+            }
+        }
+        mSourceMapped.resize(kept);
+        std::swap(mCurrent, mOutside);
+    }
+    mParts[count].append(mCurrent);
+    mCurrent.clear();
+
+    for (uint32_t i = 0; i <= count; ++i)
+    {
+        parts[i] = mParts[i].createMesh();
+    }
+}
+
+Mesh* MeshClipper::createMesh() const
+{
+    return mCurrent.createMesh();
+}
+
+void MeshClipper::getCrackEdges(std::vector<std::pair<Vertex, Vertex>>& edges) const
+{
+    for (uint32_t i = 0; i < mCurrent.edges.size(); ++i)
+    {
+        if (mCurrent.edgeIsCrack[i])
+        {
+            edges.push_back(std::make_pair(mCurrent.vertices[mCurrent.edges[i].s], mCurrent.vertices[mCurrent.edges[i].e]));
+        }
+    }
+}
+
+uint32_t MeshClipper::mapVertex(uint32_t vertex, Geometry& dst)
+{
+    if (mVertexMap[vertex] < 0)
+    {
+        mVertexMap[vertex] = static_cast<int32_t>(dst.vertices.size());
+        dst.vertices.push_back(mCurrent.vertices[vertex]);
+    }
+    return static_cast<uint32_t>(mVertexMap[vertex]);
+}
+
+uint32_t MeshClipper::getCrossVertex(uint32_t s, uint32_t e, Geometry& dst)
+{
+    const uint64_t key = s < e ? (uint64_t(s) << 32 | e) : (uint64_t(e) << 32 | s);
+    auto it = mCrossVertices.find(key);
+    if (it != mCrossVertices.end())
+    {
+        return it->second;
+    }
+
+    /**
+        Interpolate from lexicographically smaller end, so the point doesn't depend on edge direction or vertex indices
+    */
+    if (isLexicographicallyLess(mCurrent.vertices[e].p, mCurrent.vertices[s].p))
+    {
+        std::swap(s, e);
+    }
+    const double ds = mDistances[s];
+    const double de = mDistances[e];
+    uint32_t result;
+    if (ds == 0.0 || de == 0.0)
+    {
+        result = mapVertex(ds == 0.0 ? s : e, dst);
+    }
+    else
+    {
+        const Vertex& a = mCurrent.vertices[s];
+        const Vertex& b = mCurrent.vertices[e];
+        const double t  = ds / (ds - de);
+        Vertex p;
+        p.p = { (float)(a.p.x + (b.p.x - a.p.x) * t), (float)(a.p.y + (b.p.y - a.p.y) * t), (float)(a.p.z + (b.p.z - a.p.z) * t) };
+        p.n = { (float)(a.n.x + (b.n.x - a.n.x) * t), (float)(a.n.y + (b.n.y - a.n.y) * t), (float)(a.n.z + (b.n.z - a.n.z) * t) };
+        p.uv[0] = { (float)(a.uv[0].x + (b.uv[0].x - a.uv[0].x) * t), (float)(a.uv[0].y + (b.uv[0].y - a.uv[0].y) * t) };
+        result  = static_cast<uint32_t>(dst.vertices.size());
+        dst.vertices.push_back(p);
+    }
+    mCrossVertices[key] = result;
+    return result;
+}
+
+NV_FORCE_INLINE void MeshClipper::addEdge(uint32_t s, uint32_t e, uint8_t isCrack, Geometry& dst)
+{
+    // Edges ending at a vertex on the plane degenerate to a point
+    if (s != e)
+    {
+        dst.edges.push_back({ s, e });
+        dst.edgeIsCrack.push_back(isCrack);
+    }
+}
+
+void MeshClipper::buildPart(const ClipPlane& plane, bool inside, Geometry& dst)
+{
+    dst.clear();
+    mVertexMap.assign(mCurrent.vertices.size(), -1);
+    mCrossVertices.clear();
+    mCapSegments.clear();
+
+    auto isKept = [&](uint32_t vertex) { return (mDistances[vertex] <= 0.0) == inside; };
+
+    for (uint32_t f = 0; f < mCurrent.facets.size(); ++f)
+    {
+        const Facet& facet     = mCurrent.facets[f];
+        const uint32_t first   = static_cast<uint32_t>(dst.edges.size());
+        mExits.clear();
+        mEntries.clear();
+        for (uint32_t i = facet.firstEdgeNumber; i < facet.firstEdgeNumber + facet.edgesCount; ++i)
+        {
+            const Edge& edge = mCurrent.edges[i];
+            const bool keepS = isKept(edge.s);
+            const bool keepE = isKept(edge.e);
+            if (keepS && keepE)
+            {
+                addEdge(mapVertex(edge.s, dst), mapVertex(edge.e, dst), mCurrent.edgeIsCrack[i], dst);
+            }
+            else if (keepS)
+            {
+                const uint32_t p = getCrossVertex(edge.s, edge.e, dst);
+                addEdge(mapVertex(edge.s, dst), p, mCurrent.edgeIsCrack[i], dst);
+                mExits.push_back(p);
+            }
+            else if (keepE)
+            {
+                const uint32_t p = getCrossVertex(edge.s, edge.e, dst);
+                addEdge(p, mapVertex(edge.e, dst), mCurrent.edgeIsCrack[i], dst);
+                mEntries.push_back(p);
+            }
+        }
+
+        if (mExits.size() != mEntries.size())
+        {
+            NVBLAST_LOG_ERROR("MeshClipper: not equal number of exit and entry points! Probably input mesh has open edges.");
+        }
+        else if (!mExits.empty())
+        {
+            /**
+                Cut of a facet is a set of segments on a line, all going from exit to entry point in the same
+                direction. Points are sorted along it and paired in order, same as BooleanEvaluator does.
+            */
+            NvcVec3 base = { 0.0f, 0.0f, 0.0f };
+            for (uint32_t k = 0; k < mExits.size(); ++k)
+            {
+                base.x += dst.vertices[mEntries[k]].p.x - dst.vertices[mExits[k]].p.x;
+                base.y += dst.vertices[mEntries[k]].p.y - dst.vertices[mExits[k]].p.y;
+                base.z += dst.vertices[mEntries[k]].p.z - dst.vertices[mExits[k]].p.z;
+            }
+            auto comp = [&](uint32_t a, uint32_t b)
+            {
+                const NvcVec3& pa = dst.vertices[a].p;
+                const NvcVec3& pb = dst.vertices[b].p;
+                return (pb.x - pa.x) * base.x + (pb.y - pa.y) * base.y + (pb.z - pa.z) * base.z > 0.0f;
+            };
+            if (mExits.size() > 1)
+            {
+                std::sort(mExits.begin(), mExits.end(), comp);
+                std::sort(mEntries.begin(), mEntries.end(), comp);
+            }
+            const uint8_t isCrack = mCurrent.facetIsCap[f] ? 0 : 1;
+            for (uint32_t k = 0; k < mExits.size(); ++k)
+            {
+                addEdge(mExits[k], mEntries[k], isCrack, dst);
+                mCapSegments.push_back(std::make_pair(mEntries[k], mExits[k]));
+            }
+        }
+
+        const uint32_t edgeCount = static_cast<uint32_t>(dst.edges.size()) - first;
+        if (edgeCount < 3)
+        {
+            dst.edges.resize(first);
+            dst.edgeIsCrack.resize(first);
+            continue;
+        }
+        Facet newFacet           = facet;
+        newFacet.firstEdgeNumber = static_cast<int32_t>(first);
+        newFacet.edgesCount      = edgeCount;
+        dst.facets.push_back(newFacet);
+        dst.facetIsCap.push_back(mCurrent.facetIsCap[f]);
+    }
+
+    addCap(plane, inside, dst);
+}
+
+void MeshClipper::addCap(const ClipPlane& plane, bool inside, Geometry& dst)
+{
+    if (mCapSegments.size() < 3)
+    {
+        return;
+    }
+
+    /**
+        Facets sharing an edge may have different vertices at its cut point, cap vertices are welded by position
+    */
+    mCapPoints.clear();
+    for (const auto& segment : mCapSegments)
+    {
+        mCapPoints.push_back(segment.first);
+        mCapPoints.push_back(segment.second);
+    }
+    std::sort(mCapPoints.begin(), mCapPoints.end(), [&](uint32_t a, uint32_t b)
+    {
+        return isLexicographicallyLess(dst.vertices[a].p, dst.vertices[b].p) ||
+               (!isLexicographicallyLess(dst.vertices[b].p, dst.vertices[a].p) && a < b);
+    });
+
+    const float sign          = inside ? 1.0f : -1.0f;
+    const NvcVec3 normal      = { plane.capNormal.x * sign, plane.capNormal.y * sign, plane.capNormal.z * sign };
+    const uint32_t capVertex0 = static_cast<uint32_t>(dst.vertices.size());
+    mCapVertexMap.assign(capVertex0, -1);
+    for (uint32_t i = 0; i < mCapPoints.size(); ++i)
+    {
+        const uint32_t point = mCapPoints[i];
+        if (mCapVertexMap[point] >= 0)
+        {
+            continue;
+        }
+        const NvcVec3 p = dst.vertices[point].p;
+        if (i > 0 && p.x == dst.vertices[mCapPoints[i - 1]].p.x && p.y == dst.vertices[mCapPoints[i - 1]].p.y &&
+            p.z == dst.vertices[mCapPoints[i - 1]].p.z)
+        {
+            mCapVertexMap[point] = mCapVertexMap[mCapPoints[i - 1]];
+            continue;
+        }
+        Vertex capVertex;
+        capVertex.p     = p;
+        capVertex.n     = normal;
+        capVertex.uv[0] = { (float)(plane.u[0] * p.x + plane.u[1] * p.y + plane.u[2] * p.z),
+                            (float)(plane.v[0] * p.x + plane.v[1] * p.y + plane.v[2] * p.z) };
+        mCapVertexMap[point] = static_cast<int32_t>(dst.vertices.size());
+        dst.vertices.push_back(capVertex);
+    }
+
+    const uint32_t first = static_cast<uint32_t>(dst.edges.size());
+    for (const auto& segment : mCapSegments)
+    {
+        addEdge(mCapVertexMap[segment.first], mCapVertexMap[segment.second], 0, dst);
+    }
+    const uint32_t edgeCount = static_cast<uint32_t>(dst.edges.size()) - first;
+    if (edgeCount < 3)
+    {
+        dst.edges.resize(first);
+        dst.edgeIsCrack.resize(first);
+        dst.vertices.resize(capVertex0);
+        return;
+    }
+    Facet cap;
+    cap.firstEdgeNumber = static_cast<int32_t>(first);
+    cap.edgesCount      = edgeCount;
+    cap.userData        = inside ? plane.userData : -plane.userData;
+    cap.materialId      = plane.materialId;
+    cap.smoothingGroup  = -1;
+    dst.facets.push_back(cap);
+    dst.facetIsCap.push_back(1);
+}
+
+}  // namespace Blast
+}  // namespace Nv
@@ -0,0 +1,156 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+#ifndef NVBLASTEXTAUTHORINGMESHCLIPPER_H
+#define NVBLASTEXTAUTHORINGMESHCLIPPER_H
+
+#include "NvBlastExtAuthoringTypes.h"
+#include <vector>
+#include <utility>
+#include <unordered_map>
+
+namespace Nv
+{
+namespace Blast
+{
+
+class Mesh;
+
+/**
+    Orthonormal u, v axes in the plane with normal n, u x v = n.
+*/
+void getPlaneBasis(const double n[3], double u[3], double v[3]);
+
+/**
+    Clipping plane of MeshClipper. Points with n.p + d <= 0 are inside, the rest is outside.
+*/
+struct ClipPlane
+{
+    double      n[3];       // Normalized plane normal, outward normal of the cap of inside part
+    double      d;          // Plane offset
+    double      u[3];       // Cap UV is (u.p, v.p), axes don't have to be normalized
+    double      v[3];
+    NvcVec3     capNormal;  // Vertex normal of the cap of inside part, outside part gets -capNormal
+    int64_t     userData;   // Facet user data of the cap of inside part, outside part gets -userData
+    int32_t     materialId; // Material of caps
+
+    /**
+        Plane through point, cap normal is normal and UV is planar projection on getPlaneBasis(...) axes.
+    */
+    void        init(const NvcVec3& normal, const NvcVec3& point, int64_t userData, int32_t materialId);
+};
+
+/**
+    Exact clipping of closed polygonal mesh by planes. Each clip is a single pass over the geometry: vertices are
+    classified by signed distance, crossing edges are split and the cut of every facet is closed by a cap facet.
+    Intersection points of an edge are computed from its lexicographically smaller end, so facets sharing the edge
+    get the same point. Vertices on the plane are inside, facets left with less than 3 edges are dropped.
+    Gives the same geometry as boolean intersection with a large box, without its approximation of the plane.
+*/
+class MeshClipper
+{
+public:
+    /**
+        Set geometry to clip, mesh is copied. Cuts of its facets are reported by getCrackEdges(...).
+    */
+    void                setMesh(const Mesh* mesh);
+
+    /**
+        Keep inside part of current geometry.
+        \return false if nothing is left
+    */
+    bool                clip(const ClipPlane& plane);
+
+    /**
+        Split current geometry into inside and outside parts, current geometry becomes the inside part.
+        \param[out] inside   Inside part, nullptr if empty
+        \param[out] outside  Outside part, nullptr if empty
+    */
+    void                split(const ClipPlane& plane, Mesh*& inside, Mesh*& outside);
+
+    /**
+        Partition current geometry by planes in one sweep. Part i < count is inside planes[i] and outside all planes
+        before it, part count is outside all planes, so it is the same geometry as count split(...) calls each made on
+        the outside part of the previous one. Every vertex is classified once, facets lying in one part are moved to it
+        directly and only facets crossing the planes are clipped, plane by plane. Current geometry becomes empty.
+        \param[in]  planes  Planes in cutting order, usually nearly parallel and sorted along their normal
+        \param[out] parts   count + 1 parts, nullptr for empty ones
+    */
+    void                partition(const ClipPlane* planes, uint32_t count, std::vector<Mesh*>& parts);
+
+    bool                isEmpty() const { return mCurrent.facets.empty(); }
+
+    /**
+        Create mesh of current geometry, nullptr if it is empty.
+    */
+    Mesh*               createMesh() const;
+
+    /**
+        Append cuts of facets of mesh set with setMesh(...) by the planes, in the same form as
+        BooleanEvaluator::setCrackEdges(...) gives them.
+    */
+    void                getCrackEdges(std::vector<std::pair<Vertex, Vertex>>& edges) const;
+
+private:
+    struct Geometry
+    {
+        std::vector<Vertex>     vertices;
+        std::vector<Edge>       edges;
+        std::vector<uint8_t>    edgeIsCrack;
+        std::vector<Facet>      facets;
+        std::vector<uint8_t>    facetIsCap;
+
+        void    clear();
+        void    append(const Geometry& src);
+        Mesh*   createMesh() const;
+    };
+
+    void                classify(const ClipPlane& plane);
+    void                buildPart(const ClipPlane& plane, bool inside, Geometry& dst);
+    uint32_t            mapVertex(uint32_t vertex, Geometry& dst);
+    uint32_t            getCrossVertex(uint32_t s, uint32_t e, Geometry& dst);
+    void                addEdge(uint32_t s, uint32_t e, uint8_t isCrack, Geometry& dst);
+    void                addCap(const ClipPlane& plane, bool inside, Geometry& dst);
+
+    Geometry            mCurrent;
+    Geometry            mInside;
+    Geometry            mOutside;
+
+    /* Scratch buffers, kept between clips to avoid allocations */
+    std::vector<double>                         mDistances;
+    std::vector<int32_t>                        mVertexMap;
+    std::unordered_map<uint64_t, uint32_t>      mCrossVertices;
+    std::vector<uint32_t>                       mExits;
+    std::vector<uint32_t>                       mEntries;
+    std::vector<std::pair<uint32_t, uint32_t>>  mCapSegments;
+    std::vector<uint32_t>                       mCapPoints;
+    std::vector<int32_t>                        mCapVertexMap;
+
+    /* Partition state */
+    Geometry                                    mSource;
+    std::vector<Geometry>                       mParts;
+    std::vector<uint32_t>                       mVertexPart;
+    std::vector<uint32_t>                       mFacetPart;
+    std::vector<uint32_t>                       mCrossingOffsets;
+    std::vector<uint32_t>                       mCrossingFacets;
+    std::vector<int32_t>                        mSourceMap;
+    std::vector<uint32_t>                       mSourceMapped;
+};
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGMESHCLIPPER_H
@@ -0,0 +1,493 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+#include "NvBlastExtAuthoringNoiseSurface.h"
+#include "NvBlastExtAuthoringMeshClipper.h"
+#include "NvBlastExtAuthoringMeshImpl.h"
+#include <algorithm>
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NV_NOISE_SURFACE_SSE 1
+#include <emmintrin.h>
+#else
+#define NV_NOISE_SURFACE_SSE 0
+#endif
+
+namespace Nv
+{
+namespace Blast
+{
+
+// Gradient directions of lattice points
+static const float kGradientX[8] = { 1.0f, -1.0f, 0.0f, 0.0f, 0.70710678f, -0.70710678f, 0.70710678f, -0.70710678f };
+static const float kGradientY[8] = { 0.0f, 0.0f, 1.0f, -1.0f, 0.70710678f, 0.70710678f, -0.70710678f, -0.70710678f };
+
+// Lattice shift between octaves, so their lattice points don't line up
+static const float kOctaveShift = 17.1313f;
+
+/**
+    Seeded permutation of [0, 256), repeated twice so a lookup of a lookup doesn't need wrapping.
+*/
+static void buildPermutation(int32_t seed, uint8_t permutation[512])
+{
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        permutation[i] = static_cast<uint8_t>(i);
+    }
+    uint32_t state = static_cast<uint32_t>(seed) * 747796405u + 2891336453u;
+    for (uint32_t i = 255; i > 0; --i)
+    {
+        state = state * 1664525u + 1013904223u;
+        std::swap(permutation[i], permutation[(state >> 8) % (i + 1)]);
+    }
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        permutation[256 + i] = permutation[i];
+    }
+}
+
+static inline float fade(float t)
+{
+    return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f);
+}
+
+/**
+    Parts of 2D gradient noise which depend on y only, they are the same for the whole row.
+*/
+struct NoiseRow
+{
+    int32_t iy;     // Lattice row
+    float   y0;     // Offset from lattice row
+    float   y1;     // Offset from next lattice row
+    float   fy;     // Fade of y0
+
+    NoiseRow(float y)
+    {
+        const float fl = floorf(y);
+        iy = static_cast<int32_t>(fl);
+        y0 = y - fl;
+        y1 = y0 - 1.0f;
+        fy = fade(y0);
+    }
+};
+
+/**
+    heights[i] += amplitude * noise(xStart + i * xStep, row), i in [first, first + count).
+*/
+static void addNoiseRowScalar(const uint8_t* permutation, const NoiseRow& row, float xStart, float xStep,
+                              float amplitude, uint32_t first, uint32_t count, float* heights)
+{
+    const uint8_t* rowLo = permutation + (row.iy & 255);
+    const uint8_t* rowHi = permutation + ((row.iy + 1) & 255);
+    for (uint32_t i = first; i < first + count; ++i)
+    {
+        const float x  = xStart + static_cast<float>(i) * xStep;
+        const float fl = floorf(x);
+        const int32_t ix = static_cast<int32_t>(fl);
+        const float x0 = x - fl;
+        const float x1 = x0 - 1.0f;
+        const uint32_t h00 = rowLo[permutation[ix & 255]] & 7;
+        const uint32_t h10 = rowLo[permutation[(ix + 1) & 255]] & 7;
+        const uint32_t h01 = rowHi[permutation[ix & 255]] & 7;
+        const uint32_t h11 = rowHi[permutation[(ix + 1) & 255]] & 7;
+        const float n00 = kGradientX[h00] * x0 + kGradientY[h00] * row.y0;
+        const float n10 = kGradientX[h10] * x1 + kGradientY[h10] * row.y0;
+        const float n01 = kGradientX[h01] * x0 + kGradientY[h01] * row.y1;
+        const float n11 = kGradientX[h11] * x1 + kGradientY[h11] * row.y1;
+        const float fx  = fade(x0);
+        const float nx0 = n00 + fx * (n10 - n00);
+        const float nx1 = n01 + fx * (n11 - n01);
+        heights[i] += amplitude * (nx0 + row.fy * (nx1 - nx0));
+    }
+}
+
+#if NV_NOISE_SURFACE_SSE
+/**
+    SSE version of addNoiseRowScalar, 4 samples at a time. Lattice hashes are looked up per lane, everything else is
+    vectorized. Operations are the same as in the scalar kernel, so results are too.
+*/
+static void addNoiseRowSSE(const uint8_t* permutation, const NoiseRow& row, float xStart, float xStep, float amplitude,
+                           uint32_t count, float* heights)
+{
+    const uint8_t* rowLo = permutation + (row.iy & 255);
+    const uint8_t* rowHi = permutation + ((row.iy + 1) & 255);
+    const __m128 start   = _mm_set1_ps(xStart);
+    const __m128 step    = _mm_set1_ps(xStep);
+    const __m128 one     = _mm_set1_ps(1.0f);
+    const __m128 six     = _mm_set1_ps(6.0f);
+    const __m128 fifteen = _mm_set1_ps(15.0f);
+    const __m128 ten     = _mm_set1_ps(10.0f);
+    const __m128 y0      = _mm_set1_ps(row.y0);
+    const __m128 y1      = _mm_set1_ps(row.y1);
+    const __m128 fy      = _mm_set1_ps(row.fy);
+    const __m128 amp     = _mm_set1_ps(amplitude);
+
+    const uint32_t simdCount = count & ~3u;
+    int32_t lattice[4];
+    for (uint32_t i = 0; i < simdCount; i += 4)
+    {
+        const __m128 index = _mm_cvtepi32_ps(_mm_setr_epi32(i, i + 1, i + 2, i + 3));
+        const __m128 x     = _mm_add_ps(start, _mm_mul_ps(index, step));
+
+        // floor(x) = trunc(x) - (trunc(x) > x)
+        __m128 fl = _mm_cvtepi32_ps(_mm_cvttps_epi32(x));
+        fl        = _mm_sub_ps(fl, _mm_and_ps(_mm_cmpgt_ps(fl, x), one));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lattice), _mm_cvttps_epi32(fl));
+
+        float g[8][4];
+        for (uint32_t l = 0; l < 4; ++l)
+        {
+            const int32_t ix   = lattice[l];
+            const uint32_t h00 = rowLo[permutation[ix & 255]] & 7;
+            const uint32_t h10 = rowLo[permutation[(ix + 1) & 255]] & 7;
+            const uint32_t h01 = rowHi[permutation[ix & 255]] & 7;
+            const uint32_t h11 = rowHi[permutation[(ix + 1) & 255]] & 7;
+            g[0][l] = kGradientX[h00];
+            g[1][l] = kGradientY[h00];
+            g[2][l] = kGradientX[h10];
+            g[3][l] = kGradientY[h10];
+            g[4][l] = kGradientX[h01];
+            g[5][l] = kGradientY[h01];
+            g[6][l] = kGradientX[h11];
+            g[7][l] = kGradientY[h11];
+        }
+
+        const __m128 x0  = _mm_sub_ps(x, fl);
+        const __m128 x1  = _mm_sub_ps(x0, one);
+        const __m128 n00 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(g[0]), x0), _mm_mul_ps(_mm_loadu_ps(g[1]), y0));
+        const __m128 n10 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(g[2]), x1), _mm_mul_ps(_mm_loadu_ps(g[3]), y0));
+        const __m128 n01 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(g[4]), x0), _mm_mul_ps(_mm_loadu_ps(g[5]), y1));
+        const __m128 n11 = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(g[6]), x1), _mm_mul_ps(_mm_loadu_ps(g[7]), y1));
+
+        // fade(t) = t * t * t * (t * (t * 6 - 15) + 10)
+        const __m128 fx = _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(x0, x0), x0),
+                                     _mm_add_ps(_mm_mul_ps(x0, _mm_sub_ps(_mm_mul_ps(x0, six), fifteen)), ten));
+        const __m128 nx0 = _mm_add_ps(n00, _mm_mul_ps(fx, _mm_sub_ps(n10, n00)));
+        const __m128 nx1 = _mm_add_ps(n01, _mm_mul_ps(fx, _mm_sub_ps(n11, n01)));
+        const __m128 n   = _mm_add_ps(nx0, _mm_mul_ps(fy, _mm_sub_ps(nx1, nx0)));
+        _mm_storeu_ps(heights + i, _mm_add_ps(_mm_loadu_ps(heights + i), _mm_mul_ps(amp, n)));
+    }
+    addNoiseRowScalar(permutation, row, xStart, xStep, amplitude, simdCount, count - simdCount, heights);
+}
+#endif
+
+NoiseHeightfield::NoiseHeightfield(float frequency, int32_t octaves, uint32_t resolutionX, uint32_t resolutionY,
+                                   float patchSize, int32_t seed)
+: mFrequency(frequency)
+, mOctaves(octaves)
+, mResolutionX(resolutionX)
+, mResolutionY(resolutionY)
+, mPatchSize(patchSize)
+, mSeed(seed)
+{
+    uint8_t permutation[512];
+    buildPermutation(seed, permutation);
+
+    const uint32_t width  = 2 * resolutionX + 1;
+    const uint32_t height = 2 * resolutionY + 1;
+    const float stepX     = 2.0f * patchSize / resolutionX;
+    const float stepY     = 2.0f * patchSize / resolutionY;
+    mHeights.assign(width * height, 0.0f);
+
+    float octaveFrequency = frequency;
+    float octaveAmplitude = 1.0f;
+    for (int32_t octave = 0; octave < octaves; ++octave)
+    {
+        const float shift  = kOctaveShift * octave;
+        const float xStart = -patchSize * octaveFrequency + shift;
+        const float xStep  = stepX * octaveFrequency;
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            const NoiseRow row((-patchSize + y * stepY) * octaveFrequency + shift);
+#if NV_NOISE_SURFACE_SSE
+            addNoiseRowSSE(permutation, row, xStart, xStep, octaveAmplitude, width, &mHeights[y * width]);
+#else
+            addNoiseRowScalar(permutation, row, xStart, xStep, octaveAmplitude, 0, width, &mHeights[y * width]);
+#endif
+        }
+        octaveFrequency *= 2.0f;
+        octaveAmplitude *= 0.5f;
+    }
+}
+
+bool NoiseHeightfield::matches(float frequency, int32_t octaves, uint32_t resolutionX, uint32_t resolutionY,
+                               float patchSize, int32_t seed) const
+{
+    return mFrequency == frequency && mOctaves == octaves && mResolutionX == resolutionX &&
+           mResolutionY == resolutionY && mPatchSize == patchSize && mSeed == seed;
+}
+
+NoiseSurfaceCache::NoiseSurfaceCache(uint32_t maxCount) : mMaxCount(std::max(maxCount, 1u))
+{
+}
+
+NoiseSurfaceCache::~NoiseSurfaceCache()
+{
+    clear();
+}
+
+NoisyCuttingSurface NoiseSurfaceCache::getSurface(float patchSize, const NvcVec3& resolution, float frequency,
+                                                  int32_t octaves, int32_t seed, float randomValue)
+{
+    const double sz = 2.0 * patchSize;
+    const double maxResolution = std::max(std::max(resolution.x, resolution.y), resolution.z);
+    const uint32_t resolutionX = std::max(1u, (uint32_t)floor(sz * maxResolution + 0.5));
+    const uint32_t resolutionY = resolutionX;
+
+    NoisyCuttingSurface surface;
+    surface.heightfield = nullptr;
+    for (uint32_t i = 0; i < mHeightfields.size(); ++i)
+    {
+        if (mHeightfields[i]->matches(frequency, octaves, resolutionX, resolutionY, patchSize, seed))
+        {
+            surface.heightfield = mHeightfields[i];
+            mHeightfields.erase(mHeightfields.begin() + i);
+            break;
+        }
+    }
+    if (surface.heightfield == nullptr)
+    {
+        surface.heightfield = new NoiseHeightfield(frequency, octaves, resolutionX, resolutionY, patchSize, seed);
+    }
+    mHeightfields.push_back(const_cast<NoiseHeightfield*>(surface.heightfield));
+    trim(mMaxCount);
+
+    const double window = std::min(std::max((double)randomValue, 0.0), 1.0) * (resolutionX + 1);
+    surface.windowX     = std::min((uint32_t)window, resolutionX);
+    surface.windowY     = (uint32_t)(window * (resolutionY + 1)) % (resolutionY + 1);
+    return surface;
+}
+
+void NoiseSurfaceCache::trim(uint32_t maxCount)
+{
+    if (mHeightfields.size() <= maxCount)
+    {
+        return;
+    }
+    const uint32_t removeCount = static_cast<uint32_t>(mHeightfields.size()) - maxCount;
+    for (uint32_t i = 0; i < removeCount; ++i)
+    {
+        delete mHeightfields[i];
+    }
+    mHeightfields.erase(mHeightfields.begin(), mHeightfields.begin() + removeCount);
+}
+
+void NoiseSurfaceCache::clear()
+{
+    trim(0);
+}
+
+Mesh* createNoisyCuttingBox(const NoisyCuttingSurface& surface, const NvcVec3& point, const NvcVec3& normal, float size,
+                            float amplitude, int64_t id, int32_t interiorMaterialId, const NvcBounds3& bounds)
+{
+    const NoiseHeightfield& heightfield = *surface.heightfield;
+    const double length = sqrt((double)normal.x * normal.x + (double)normal.y * normal.y + (double)normal.z * normal.z);
+    const double n[3]   = { normal.x / length, normal.y / length, normal.z / length };
+    double t1[3], t2[3];
+    getPlaneBasis(n, t1, t2);
+
+    const int32_t resolutionX = static_cast<int32_t>(heightfield.getResolutionX());
+    const int32_t resolutionY = static_cast<int32_t>(heightfield.getResolutionY());
+    const double patchSize    = heightfield.getPatchSize();
+    const double stepX        = 2.0 * patchSize / resolutionX;
+    const double stepY        = 2.0 * patchSize / resolutionY;
+
+    /**
+        Part of the patch over bounds, expanded by one cell so heights on its border can be zeroed
+    */
+    double footprint[4] = { 1e30, -1e30, 1e30, -1e30 };
+    for (uint32_t corner = 0; corner < 8; ++corner)
+    {
+        const double c[3] = { (corner & 1 ? bounds.maximum.x : bounds.minimum.x) - point.x,
+                              (corner & 2 ? bounds.maximum.y : bounds.minimum.y) - point.y,
+                              (corner & 4 ? bounds.maximum.z : bounds.minimum.z) - point.z };
+        const double u = c[0] * t1[0] + c[1] * t1[1] + c[2] * t1[2];
+        const double v = c[0] * t2[0] + c[1] * t2[1] + c[2] * t2[2];
+        footprint[0] = std::min(footprint[0], u);
+        footprint[1] = std::max(footprint[1], u);
+        footprint[2] = std::min(footprint[2], v);
+        footprint[3] = std::max(footprint[3], v);
+    }
+    auto toCell = [](double x, double step, int32_t resolution, int32_t bias)
+    {
+        return (int32_t)std::min(std::max(floor(x / step) + bias, 0.0), (double)resolution);
+    };
+    const int32_t i0 = toCell(footprint[0] + patchSize, stepX, resolutionX, -1);
+    const int32_t i1 = toCell(footprint[1] + patchSize, stepX, resolutionX, 2);
+    const int32_t j0 = toCell(footprint[2] + patchSize, stepY, resolutionY, -1);
+    const int32_t j1 = toCell(footprint[3] + patchSize, stepY, resolutionY, 2);
+    const bool isNoisy = amplitude != 0.0f && i1 - i0 >= 2 && j1 - j0 >= 2;
+
+    std::vector<Vertex> vertices;
+    std::vector<Edge> edges;
+    std::vector<Facet> facets;
+
+    auto addVertex = [&](double u, double v, double h, const double normalDir[3])
+    {
+        Vertex vertex;
+        vertex.p = { (float)(point.x + u * t1[0] + v * t2[0] + h * n[0]),
+                     (float)(point.y + u * t1[1] + v * t2[1] + h * n[1]),
+                     (float)(point.z + u * t1[2] + v * t2[2] + h * n[2]) };
+        vertex.n = { (float)normalDir[0], (float)normalDir[1], (float)normalDir[2] };
+        vertex.uv[0] = { (float)(t1[0] * vertex.p.x + t1[1] * vertex.p.y + t1[2] * vertex.p.z),
+                         (float)(t2[0] * vertex.p.x + t2[1] * vertex.p.y + t2[2] * vertex.p.z) };
+        vertices.push_back(vertex);
+        return static_cast<uint32_t>(vertices.size() - 1);
+    };
+    std::vector<uint32_t> loop;
+    auto addFacet = [&](bool reverse)
+    {
+        if (reverse)
+        {
+            std::reverse(loop.begin(), loop.end());
+        }
+        Facet facet;
+        facet.firstEdgeNumber = static_cast<int32_t>(edges.size());
+        facet.edgesCount      = static_cast<uint32_t>(loop.size());
+        facet.userData        = id;
+        facet.materialId      = interiorMaterialId;
+        facet.smoothingGroup  = -1;
+        for (uint32_t k = 0; k < loop.size(); ++k)
+        {
+            edges.push_back({ loop[k], loop[(k + 1) % loop.size()] });
+        }
+        facets.push_back(facet);
+        loop.clear();
+    };
+
+    /**
+        Noisy face vertices look into the box, so the part behind the face gets them as outward normals. Side and top
+        faces never reach the chunk, they share vertices and normals with the noisy face. Basis (t1, t2, n) is
+        right-handed, loops are listed counterclockwise in the plane of their first two axes and reversed where
+        that gives inward facet normal.
+    */
+    const double s         = size;
+    const double upward[3] = { n[0], n[1], n[2] };
+    const uint32_t b00 = addVertex(-s, -s, 0, upward);
+    const uint32_t b10 = addVertex(s, -s, 0, upward);
+    const uint32_t b11 = addVertex(s, s, 0, upward);
+    const uint32_t b01 = addVertex(-s, s, 0, upward);
+    const uint32_t t00 = addVertex(-s, -s, s, upward);
+    const uint32_t t10 = addVertex(s, -s, s, upward);
+    const uint32_t t11 = addVertex(s, s, s, upward);
+    const uint32_t t01 = addVertex(-s, s, s, upward);
+
+    uint32_t l0 = 0, l1 = 0, r0 = 0, r1 = 0;
+    if (isNoisy)
+    {
+        const double v0 = -patchSize + j0 * stepY;
+        const double v1 = -patchSize + j1 * stepY;
+        l0 = addVertex(-s, v0, 0, upward);
+        l1 = addVertex(-s, v1, 0, upward);
+        r0 = addVertex(s, v0, 0, upward);
+        r1 = addVertex(s, v1, 0, upward);
+
+        const int32_t width  = i1 - i0 + 1;
+        const int32_t height = j1 - j0 + 1;
+        std::vector<double> heights(width * height, 0.0);
+        for (int32_t j = 1; j < height - 1; ++j)
+        {
+            for (int32_t i = 1; i < width - 1; ++i)
+            {
+                heights[j * width + i] =
+                    amplitude * heightfield.getHeight(surface.windowX + i0 + i, surface.windowY + j0 + j);
+            }
+        }
+        const uint32_t grid0 = static_cast<uint32_t>(vertices.size());
+        for (int32_t j = 0; j < height; ++j)
+        {
+            for (int32_t i = 0; i < width; ++i)
+            {
+                const double du = (heights[j * width + std::min(i + 1, width - 1)] - heights[j * width + std::max(i - 1, 0)]) / (2.0 * stepX);
+                const double dv = (heights[std::min(j + 1, height - 1) * width + i] - heights[std::max(j - 1, 0) * width + i]) / (2.0 * stepY);
+                double nrm[3] = { n[0] - du * t1[0] - dv * t2[0], n[1] - du * t1[1] - dv * t2[1], n[2] - du * t1[2] - dv * t2[2] };
+                const double nl = sqrt(nrm[0] * nrm[0] + nrm[1] * nrm[1] + nrm[2] * nrm[2]);
+                nrm[0] /= nl;
+                nrm[1] /= nl;
+                nrm[2] /= nl;
+                addVertex(-patchSize + (i0 + i) * stepX, -patchSize + (j0 + j) * stepY, heights[j * width + i], nrm);
+            }
+        }
+        auto grid = [&](int32_t i, int32_t j) { return grid0 + (j - j0) * width + (i - i0); };
+
+        for (int32_t j = j0; j < j1; ++j)
+        {
+            for (int32_t i = i0; i < i1; ++i)
+            {
+                loop = { grid(i, j), grid(i + 1, j), grid(i + 1, j + 1) };
+                addFacet(true);
+                loop = { grid(i, j), grid(i + 1, j + 1), grid(i, j + 1) };
+                addFacet(true);
+            }
+        }
+
+        // Flat strips around the noisy part
+        loop = { b00, b10, r0 };
+        for (int32_t i = i1; i >= i0; --i)
+        {
+            loop.push_back(grid(i, j0));
+        }
+        loop.push_back(l0);
+        addFacet(true);
+        loop = { l1 };
+        for (int32_t i = i0; i <= i1; ++i)
+        {
+            loop.push_back(grid(i, j1));
+        }
+        loop.insert(loop.end(), { r1, b11, b01 });
+        addFacet(true);
+        loop = { l0 };
+        for (int32_t j = j0; j <= j1; ++j)
+        {
+            loop.push_back(grid(i0, j));
+        }
+        loop.push_back(l1);
+        addFacet(true);
+        loop = { grid(i1, j0), r0, r1 };
+        for (int32_t j = j1; j > j0; --j)
+        {
+            loop.push_back(grid(i1, j));
+        }
+        addFacet(true);
+
+        loop = { b00, l0, l1, b01, t01, t00 };
+        addFacet(true);
+        loop = { b10, r0, r1, b11, t11, t10 };
+        addFacet(false);
+    }
+    else
+    {
+        loop = { b00, b10, b11, b01 };
+        addFacet(true);
+        loop = { b00, b01, t01, t00 };
+        addFacet(true);
+        loop = { b10, b11, t11, t10 };
+        addFacet(false);
+    }
+    loop = { b00, b10, t10, t00 };
+    addFacet(false);
+    loop = { b01, b11, t11, t01 };
+    addFacet(true);
+    loop = { t00, t10, t11, t01 };
+    addFacet(false);
+
+    return new MeshImpl(vertices.data(), edges.data(), facets.data(), static_cast<uint32_t>(vertices.size()),
+                        static_cast<uint32_t>(edges.size()), static_cast<uint32_t>(facets.size()));
+}
+
+}  // namespace Blast
+}  // namespace Nv
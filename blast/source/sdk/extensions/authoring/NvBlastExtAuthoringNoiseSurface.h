@@ -0,0 +1,136 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+
+#ifndef NVBLASTEXTAUTHORINGNOISESURFACE_H
+#define NVBLASTEXTAUTHORINGNOISESURFACE_H
+
+#include "NvBlastExtAuthoringTypes.h"
+#include <vector>
+
+namespace Nv
+{
+namespace Blast
+{
+
+class Mesh;
+
+/**
+    Octave gradient noise of unit amplitude sampled on a regular grid in plane coordinates. The grid covers the noisy
+    patch [-patchSize, patchSize]^2 of a cut with resolution cells per side twice in each direction, so a cut can take
+    any window of (resolution + 1)^2 samples. Octave o has frequency * 2^o and amplitude 0.5^o.
+    Rows are evaluated 4 samples at a time with SSE, scalar kernel gives the same values on other platforms.
+*/
+class NoiseHeightfield
+{
+public:
+    NoiseHeightfield(float frequency, int32_t octaves, uint32_t resolutionX, uint32_t resolutionY, float patchSize,
+                     int32_t seed);
+
+    bool        matches(float frequency, int32_t octaves, uint32_t resolutionX, uint32_t resolutionY, float patchSize,
+                        int32_t seed) const;
+
+    uint32_t    getResolutionX() const { return mResolutionX; }
+    uint32_t    getResolutionY() const { return mResolutionY; }
+    float       getPatchSize() const { return mPatchSize; }
+
+    /**
+        Sample x in [0, 2 * resolutionX], y in [0, 2 * resolutionY].
+    */
+    float       getHeight(uint32_t x, uint32_t y) const { return mHeights[y * (2 * mResolutionX + 1) + x]; }
+
+private:
+    float               mFrequency;
+    int32_t             mOctaves;
+    uint32_t            mResolutionX;
+    uint32_t            mResolutionY;
+    float               mPatchSize;
+    int32_t             mSeed;
+    std::vector<float>  mHeights;
+};
+
+/**
+    Noise of one noisy cut: cached heightfield and the window of it used by the cut.
+*/
+struct NoisyCuttingSurface
+{
+    const NoiseHeightfield* heightfield;
+    uint32_t                windowX;
+    uint32_t                windowY;
+};
+
+/**
+    Heightfields of noisy cuts, shared by all cuts with the same frequency, octaves, resolution, patch size and seed.
+    Not thread safe: surfaces are taken on the calling thread and handed to workers, which only read them.
+*/
+class NoiseSurfaceCache
+{
+public:
+    /**
+        \param[in] maxCount         Most heightfields kept, least recently used ones are released first
+    */
+    NoiseSurfaceCache(uint32_t maxCount);
+    ~NoiseSurfaceCache();
+
+    /**
+        Surface of a noisy cut. Heightfield is square, its resolution is the largest sampling resolution along x, y, z,
+        so all cuts of the same stage share one heightfield whatever their normals are. Random value of the cut picks
+        the window, so cuts with different random values get different noise from the same heightfield.
+        Heightfield of the returned surface stays valid until maxCount other heightfields are taken.
+        \param[in] patchSize        Half size of the noisy patch
+        \param[in] resolution       Samples per unit along x, y and z
+        \param[in] frequency        Noise frequency
+        \param[in] octaves          Noise octave count
+        \param[in] seed             Noise seed
+        \param[in] randomValue      Random value of the cut in [0, 1]
+    */
+    NoisyCuttingSurface getSurface(float patchSize, const NvcVec3& resolution, float frequency, int32_t octaves,
+                                   int32_t seed, float randomValue);
+
+    /**
+        Keep at most maxCount most recently used heightfields. Surfaces taken before are invalid after it.
+    */
+    void                trim(uint32_t maxCount);
+
+    void                clear();
+
+private:
+    uint32_t                        mMaxCount;
+    std::vector<NoiseHeightfield*>  mHeightfields;  // Least recently used first
+};
+
+/**
+    Cutting box with a noisy face, same shape as getNoisyCuttingBoxPair(...) gives. Box is a cube of half size size
+    on the normal side of the plane through point, its face on the plane carries the noise of surface scaled by
+    amplitude. Mesh cut by the box keeps the part behind the noisy face with its normals and facet user data.
+    Only the part of the patch over bounds (and one cell around it) is tessellated, heights on the border of this
+    part are 0 and the rest of the face is flat. No point of the chunk lies over the flat part, so the cut is the
+    same as with the whole patch tessellated.
+    \param[in] surface              Noise of the cut
+    \param[in] point                Point on the cutting plane
+    \param[in] normal               Cutting plane normal
+    \param[in] size                 Half size of the box
+    \param[in] amplitude            Noise amplitude
+    \param[in] id                   User data of noisy face facets
+    \param[in] interiorMaterialId   Material of box facets
+    \param[in] bounds               Bounds of the mesh to cut
+*/
+Mesh* createNoisyCuttingBox(const NoisyCuttingSurface& surface, const NvcVec3& point, const NvcVec3& normal, float size,
+                            float amplitude, int64_t id, int32_t interiorMaterialId, const NvcBounds3& bounds);
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGNOISESURFACE_H
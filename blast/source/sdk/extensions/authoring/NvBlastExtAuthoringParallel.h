@@ -0,0 +1,90 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#ifndef NVBLASTEXTAUTHORINGPARALLEL_H
+#define NVBLASTEXTAUTHORINGPARALLEL_H
+
+#include <stdint.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace Nv
+{
+namespace Blast
+{
+
+/**
+    Number of workers to use for a job.
+    \param[in] threadCount  Requested thread count, 0 means one thread per hardware core
+    \param[in] workCount    Number of work items in the job
+    \return                 Worker count in [1, workCount], 1 if the job should run on the calling thread only
+*/
+inline uint32_t getParallelWorkerCount(uint32_t threadCount, uint32_t workCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return std::max(1u, std::min(threadCount, workCount));
+}
+
+/**
+    Calls func(workerIndex, itemIndex) for every item in [0, workCount). Items are handed to workers on demand,
+    so the order of execution is not defined: func may only write to state owned by its worker or by its item.
+    Worker 0 is the calling thread; with a single worker no threads are created.
+    \param[in] workerCount  Number of workers, see getParallelWorkerCount
+    \param[in] workCount    Number of work items
+    \param[in] func         Functor called as func(uint32_t workerIndex, uint32_t itemIndex)
+*/
+template <typename Func>
+void parallelFor(uint32_t workerCount, uint32_t workCount, const Func& func)
+{
+    if (workerCount <= 1 || workCount <= 1)
+    {
+        for (uint32_t i = 0; i < workCount; ++i)
+        {
+            func(0u, i);
+        }
+        return;
+    }
+
+    std::atomic<uint32_t> nextItem(0);
+    auto worker = [&](uint32_t workerIndex)
+    {
+        for (uint32_t i = nextItem++; i < workCount; i = nextItem++)
+        {
+            func(workerIndex, i);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(workerCount - 1);
+    for (uint32_t w = 1; w < workerCount; ++w)
+    {
+        threads.emplace_back(worker, w);
+    }
+    worker(0);
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGPARALLEL_H
@@ -0,0 +1,556 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#include "NvBlastExtAuthoringPointClassifier.h"
+#include "NvBlastExtAuthoringMesh.h"
+#include <algorithm>
+#include <math.h>
+#include <float.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NV_POINT_CLASSIFIER_SSE 1
+#include <emmintrin.h>
+#else
+#define NV_POINT_CLASSIFIER_SSE 0
+#endif
+
+namespace Nv
+{
+namespace Blast
+{
+
+// Same initial bounds as vfStatus20 uses for the closest edge points
+static const float kClassifierExtent = 1000.0f * 1000.0f * 1000.0f;
+
+PointInMeshClassifier::PointInMeshClassifier(const Mesh* mesh)
+{
+    mMinimum[0] = mMinimum[1] = 0.0f;
+    mInvCellSize[0] = mInvCellSize[1] = 1.0f;
+    mResolution[0] = mResolution[1] = 1;
+    mFacetEdgeStart.push_back(0);
+
+    const uint32_t facetCount = mesh != nullptr ? mesh->getFacetCount() : 0;
+    if (facetCount == 0)
+    {
+        mCellStart.assign(2, 0);
+        return;
+    }
+
+    const Vertex* vertices = mesh->getVertices();
+    const Edge* edges      = mesh->getEdges();
+    std::vector<float> facetBounds(facetCount * 4);
+    float minimum[2] = { kClassifierExtent, kClassifierExtent };
+    float maximum[2] = { -kClassifierExtent, -kClassifierExtent };
+    for (uint32_t f = 0; f < facetCount; ++f)
+    {
+        const Facet* facet = mesh->getFacet(f);
+        float* bounds      = &facetBounds[f * 4];
+        bounds[0] = bounds[1] = kClassifierExtent;
+        bounds[2] = bounds[3] = -kClassifierExtent;
+        for (uint32_t k = 0; k < facet->edgesCount; ++k)
+        {
+            const Edge& edge = edges[facet->firstEdgeNumber + k];
+            const NvcVec3& s = vertices[edge.s].p;
+            const NvcVec3& e = vertices[edge.e].p;
+            mEdges.push_back({ s, e });
+            bounds[0] = std::min(bounds[0], std::min(s.x, e.x));
+            bounds[1] = std::min(bounds[1], std::min(s.y, e.y));
+            bounds[2] = std::max(bounds[2], std::max(s.x, e.x));
+            bounds[3] = std::max(bounds[3], std::max(s.y, e.y));
+        }
+        mFacetEdgeStart.push_back(static_cast<uint32_t>(mEdges.size()));
+        minimum[0] = std::min(minimum[0], bounds[0]);
+        minimum[1] = std::min(minimum[1], bounds[1]);
+        maximum[0] = std::max(maximum[0], bounds[2]);
+        maximum[1] = std::max(maximum[1], bounds[3]);
+    }
+
+    const uint32_t resolution = std::min(static_cast<uint32_t>(sqrtf(facetCount * 0.5f)) + 1, 256u);
+    for (uint32_t axis = 0; axis < 2; ++axis)
+    {
+        mMinimum[axis]    = minimum[axis];
+        mResolution[axis] = resolution;
+        const float size  = maximum[axis] - minimum[axis];
+        mInvCellSize[axis] = size > 0.0f ? resolution / size : 1.0f;
+    }
+
+    // Two passes over facet cell ranges, count and fill
+    mCellStart.assign(mResolution[0] * mResolution[1] + 1, 0);
+    for (int32_t pass = 0; pass < 2; ++pass)
+    {
+        std::vector<uint32_t> fill;
+        if (pass == 1)
+        {
+            for (uint32_t c = 1; c < mCellStart.size(); ++c)
+            {
+                mCellStart[c] += mCellStart[c - 1];
+            }
+            mCellFacets.resize(mCellStart.back());
+            fill.assign(mCellStart.begin(), mCellStart.end() - 1);
+        }
+        for (uint32_t f = 0; f < facetCount; ++f)
+        {
+            const float* bounds = &facetBounds[f * 4];
+            if (bounds[0] > bounds[2])
+            {
+                continue;
+            }
+            const uint32_t x0 = getCellCoord(bounds[0], 0), x1 = getCellCoord(bounds[2], 0);
+            const uint32_t y0 = getCellCoord(bounds[1], 1), y1 = getCellCoord(bounds[3], 1);
+            for (uint32_t y = y0; y <= y1; ++y)
+            {
+                for (uint32_t x = x0; x <= x1; ++x)
+                {
+                    const uint32_t cell = y * mResolution[0] + x;
+                    if (pass == 0)
+                    {
+                        ++mCellStart[cell + 1];
+                    }
+                    else
+                    {
+                        mCellFacets[fill[cell]++] = f;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PointInMeshClassifier::release()
+{
+    delete this;
+}
+
+uint32_t PointInMeshClassifier::getCellCoord(float value, uint32_t axis) const
+{
+    const float c = (value - mMinimum[axis]) * mInvCellSize[axis];
+    if (!(c > 0.0f))
+    {
+        return 0;
+    }
+    return std::min(static_cast<uint32_t>(std::min(c, 1e6f)), mResolution[axis] - 1);
+}
+
+/**
+    Scalar version, matches shadowing20 and vfStatus20 of the boolean tool.
+*/
+int32_t PointInMeshClassifier::facetStatus(uint32_t facet, const NvcVec3& p) const
+{
+    int32_t val  = 0;
+    NvcVec3 low  = { 0.0f, -kClassifierExtent, 0.0f };
+    NvcVec3 high = { 0.0f, kClassifierExtent, 0.0f };
+    for (uint32_t i = mFacetEdgeStart[facet]; i < mFacetEdgeStart[facet + 1]; ++i)
+    {
+        const int32_t winding = (p.x >= mEdges[i].s.x ? 1 : 0) - (p.x >= mEdges[i].e.x ? 1 : 0);
+        if (winding == 0)
+        {
+            continue;
+        }
+        NvcVec3 a = mEdges[i].s;
+        NvcVec3 b = mEdges[i].e;
+        if (a.x > b.x)
+        {
+            std::swap(a, b);
+        }
+        const float t = (p.x - a.x) / (b.x - a.x);
+        NvcVec3 onEdge;
+        if (t >= 1)
+        {
+            onEdge = b;
+        }
+        else if (t <= 0)
+        {
+            onEdge = a;
+        }
+        else
+        {
+            onEdge = { (b.x - a.x) * t + a.x, (b.y - a.y) * t + a.y, (b.z - a.z) * t + a.z };
+        }
+        if (onEdge.y < p.y)
+        {
+            val += winding;
+        }
+        if (p.y > onEdge.y && onEdge.y > low.y)
+        {
+            low = onEdge;
+        }
+        if (p.y <= onEdge.y && onEdge.y < high.y)
+        {
+            high = onEdge;
+        }
+    }
+    if (val == 0)
+    {
+        return 0;
+    }
+    const NvcVec3 vc = { high.x - low.x, high.y - low.y, high.z - low.z };
+    float t          = (std::abs(vc.x) > std::abs(vc.y)) ? (p.x - low.x) / vc.x : (p.y - low.y) / vc.y;
+    t                = std::min(1.0f, std::max(0.0f, t));
+    const float z    = t * vc.z + low.z;
+    return z < p.z ? val : 0;
+}
+
+int32_t PointInMeshClassifier::classify(const NvcVec3& point) const
+{
+    const uint32_t cell = getCellCoord(point.y, 1) * mResolution[0] + getCellCoord(point.x, 0);
+    int32_t status      = 0;
+    for (uint32_t k = mCellStart[cell]; k < mCellStart[cell + 1]; ++k)
+    {
+        status -= facetStatus(mCellFacets[k], point);
+    }
+    return status;
+}
+
+void PointInMeshClassifier::classify(const NvcVec3* points, uint32_t count, int32_t* results) const
+{
+    // Counting sort of points by grid cell, so points sharing facets are tested together
+    const uint32_t cellCount = mResolution[0] * mResolution[1];
+    std::vector<uint32_t> pointCells(count);
+    std::vector<uint32_t> pointStart(cellCount + 1, 0);
+    std::vector<uint32_t> pointOrder(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        pointCells[i] = getCellCoord(points[i].y, 1) * mResolution[0] + getCellCoord(points[i].x, 0);
+        ++pointStart[pointCells[i] + 1];
+    }
+    for (uint32_t c = 1; c <= cellCount; ++c)
+    {
+        pointStart[c] += pointStart[c - 1];
+    }
+    std::vector<uint32_t> fill(pointStart.begin(), pointStart.end() - 1);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        pointOrder[fill[pointCells[i]]++] = i;
+    }
+
+    for (uint32_t cell = 0; cell < cellCount; ++cell)
+    {
+        for (uint32_t first = pointStart[cell]; first < pointStart[cell + 1]; first += 4)
+        {
+            const uint32_t groupSize = std::min(4u, pointStart[cell + 1] - first);
+            classifyGroup(cell, points, &pointOrder[first], groupSize, results);
+        }
+    }
+}
+
+#if NV_POINT_CLASSIFIER_SSE
+
+static inline __m128 select(__m128 mask, __m128 a, __m128 b)
+{
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+/**
+    Four points against one facet at a time, lanes follow the scalar facetStatus exactly.
+*/
+void PointInMeshClassifier::classifyGroup(uint32_t cell, const NvcVec3* points, const uint32_t* indices, uint32_t count,
+                                          int32_t* results) const
+{
+    float x[4], y[4], z[4];
+    for (uint32_t l = 0; l < 4; ++l)
+    {
+        const NvcVec3& p = points[indices[std::min(l, count - 1)]];
+        x[l] = p.x, y[l] = p.y, z[l] = p.z;
+    }
+    const __m128 px   = _mm_loadu_ps(x);
+    const __m128 py   = _mm_loadu_ps(y);
+    const __m128 pz   = _mm_loadu_ps(z);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one  = _mm_set1_ps(1.0f);
+    const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    __m128i status = _mm_setzero_si128();
+
+    for (uint32_t k = mCellStart[cell]; k < mCellStart[cell + 1]; ++k)
+    {
+        const uint32_t facet = mCellFacets[k];
+        __m128i val = _mm_setzero_si128();
+        __m128 lowX = zero, lowY = _mm_set1_ps(-kClassifierExtent), lowZ = zero;
+        __m128 highX = zero, highY = _mm_set1_ps(kClassifierExtent), highZ = zero;
+        for (uint32_t i = mFacetEdgeStart[facet]; i < mFacetEdgeStart[facet + 1]; ++i)
+        {
+            const EdgeSegment& edge = mEdges[i];
+            // Masks are -1 where true, so winding = [s.x <= p.x] - [e.x <= p.x] = maskE - maskS
+            const __m128 maskS    = _mm_cmpge_ps(px, _mm_set1_ps(edge.s.x));
+            const __m128 maskE    = _mm_cmpge_ps(px, _mm_set1_ps(edge.e.x));
+            const __m128i winding = _mm_sub_epi32(_mm_castps_si128(maskE), _mm_castps_si128(maskS));
+            const __m128 crossing = _mm_xor_ps(maskS, maskE);
+            if (_mm_movemask_ps(crossing) == 0)
+            {
+                continue;
+            }
+            const NvcVec3& a = edge.s.x > edge.e.x ? edge.e : edge.s;
+            const NvcVec3& b = edge.s.x > edge.e.x ? edge.s : edge.e;
+            const __m128 ax = _mm_set1_ps(a.x), ay = _mm_set1_ps(a.y), az = _mm_set1_ps(a.z);
+            const __m128 bx = _mm_set1_ps(b.x), by = _mm_set1_ps(b.y), bz = _mm_set1_ps(b.z);
+            const __m128 t  = _mm_div_ps(_mm_sub_ps(px, ax), _mm_set1_ps(b.x - a.x));
+            const __m128 atB = _mm_cmpge_ps(t, one);
+            const __m128 atA = _mm_cmple_ps(t, zero);
+            __m128 ox = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(b.x - a.x), t), ax);
+            __m128 oy = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(b.y - a.y), t), ay);
+            __m128 oz = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(b.z - a.z), t), az);
+            ox = select(atB, bx, select(atA, ax, ox));
+            oy = select(atB, by, select(atA, ay, oy));
+            oz = select(atB, bz, select(atA, az, oz));
+
+            const __m128 below = _mm_and_ps(crossing, _mm_cmplt_ps(oy, py));
+            val = _mm_add_epi32(val, _mm_and_si128(winding, _mm_castps_si128(below)));
+            const __m128 updateLow = _mm_and_ps(below, _mm_cmpgt_ps(oy, lowY));
+            lowX = select(updateLow, ox, lowX);
+            lowY = select(updateLow, oy, lowY);
+            lowZ = select(updateLow, oz, lowZ);
+            const __m128 updateHigh = _mm_and_ps(_mm_andnot_ps(_mm_cmplt_ps(oy, py), crossing), _mm_cmplt_ps(oy, highY));
+            highX = select(updateHigh, ox, highX);
+            highY = select(updateHigh, oy, highY);
+            highZ = select(updateHigh, oz, highZ);
+        }
+        const __m128 hasVal = _mm_castsi128_ps(_mm_xor_si128(_mm_cmpeq_epi32(val, _mm_setzero_si128()), _mm_set1_epi32(-1)));
+        if (_mm_movemask_ps(hasVal) == 0)
+        {
+            continue;
+        }
+        const __m128 vcx = _mm_sub_ps(highX, lowX);
+        const __m128 vcy = _mm_sub_ps(highY, lowY);
+        const __m128 vcz = _mm_sub_ps(highZ, lowZ);
+        const __m128 useX = _mm_cmpgt_ps(_mm_and_ps(vcx, absMask), _mm_and_ps(vcy, absMask));
+        __m128 t = select(useX, _mm_div_ps(_mm_sub_ps(px, lowX), vcx), _mm_div_ps(_mm_sub_ps(py, lowY), vcy));
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+        const __m128 facetZ = _mm_add_ps(_mm_mul_ps(t, vcz), lowZ);
+        const __m128 shadows = _mm_and_ps(hasVal, _mm_cmplt_ps(facetZ, pz));
+        status = _mm_sub_epi32(status, _mm_and_si128(val, _mm_castps_si128(shadows)));
+    }
+
+    int32_t s[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(s), status);
+    for (uint32_t l = 0; l < count; ++l)
+    {
+        results[indices[l]] = s[l];
+    }
+}
+
+#else
+
+void PointInMeshClassifier::classifyGroup(uint32_t cell, const NvcVec3* points, const uint32_t* indices, uint32_t count,
+                                          int32_t* results) const
+{
+    for (uint32_t l = 0; l < count; ++l)
+    {
+        int32_t status = 0;
+        for (uint32_t k = mCellStart[cell]; k < mCellStart[cell + 1]; ++k)
+        {
+            status -= facetStatus(mCellFacets[k], points[indices[l]]);
+        }
+        results[indices[l]] = status;
+    }
+}
+
+#endif
+
+#define OCCUPANCY_GRID_TARGET_VOXELS 32768
+#define OCCUPANCY_GRID_MAX_RESOLUTION 128
+
+OccupancyGrid::OccupancyGrid(const Mesh* mesh, const PointInMeshClassifier& meshClassifier, const Mesh* stencil,
+                             const PointInMeshClassifier* stencilClassifier)
+{
+    const NvcBounds3& bounds = mesh->getBoundingBox();
+    mMinimum                 = bounds.minimum;
+    const float extent[3]    = { bounds.maximum.x - bounds.minimum.x, bounds.maximum.y - bounds.minimum.y,
+                                 bounds.maximum.z - bounds.minimum.z };
+    const float maxExtent    = std::max(extent[0], std::max(extent[1], extent[2]));
+    if (!(maxExtent > 0.0f) || mesh->getFacetCount() == 0)
+    {
+        mVoxelSize     = 1.0f;
+        mResolution[0] = mResolution[1] = mResolution[2] = 1;
+        mStates.assign(1, OUTSIDE);
+        return;
+    }
+
+    // Cubic voxels, thin axes get a single layer
+    const float thin   = maxExtent / OCCUPANCY_GRID_MAX_RESOLUTION;
+    const float volume = std::max(extent[0], thin) * std::max(extent[1], thin) * std::max(extent[2], thin);
+    mVoxelSize         = std::max(powf(volume / OCCUPANCY_GRID_TARGET_VOXELS, 1.0f / 3.0f), thin);
+    for (uint32_t axis = 0; axis < 3; ++axis)
+    {
+        mResolution[axis] = std::min(std::max(static_cast<uint32_t>(ceilf(extent[axis] / mVoxelSize)), 1u),
+                                     (uint32_t)OCCUPANCY_GRID_MAX_RESOLUTION);
+    }
+    mVoxelSize = std::max(mVoxelSize, maxExtent / OCCUPANCY_GRID_MAX_RESOLUTION);
+    mStates.assign(mResolution[0] * mResolution[1] * mResolution[2], OUTSIDE);
+
+    markFacets(mesh);
+    if (stencil != nullptr)
+    {
+        markFacets(stencil);
+    }
+
+    // Voxels not crossed by any surface are entirely inside or outside, classify them by center
+    std::vector<NvcVec3> centers;
+    std::vector<uint32_t> voxels;
+    for (uint32_t z = 0; z < mResolution[2]; ++z)
+    {
+        for (uint32_t y = 0; y < mResolution[1]; ++y)
+        {
+            for (uint32_t x = 0; x < mResolution[0]; ++x)
+            {
+                const uint32_t voxel = (z * mResolution[1] + y) * mResolution[0] + x;
+                if (mStates[voxel] != BOUNDARY)
+                {
+                    voxels.push_back(voxel);
+                    centers.push_back({ mMinimum.x + (x + 0.5f) * mVoxelSize, mMinimum.y + (y + 0.5f) * mVoxelSize,
+                                        mMinimum.z + (z + 0.5f) * mVoxelSize });
+                }
+            }
+        }
+    }
+    std::vector<int32_t> inMesh(centers.size());
+    meshClassifier.classify(centers.data(), static_cast<uint32_t>(centers.size()), inMesh.data());
+    std::vector<int32_t> inStencil(centers.size(), 1);
+    if (stencil != nullptr && stencilClassifier != nullptr)
+    {
+        stencilClassifier->classify(centers.data(), static_cast<uint32_t>(centers.size()), inStencil.data());
+    }
+    for (uint32_t i = 0; i < voxels.size(); ++i)
+    {
+        mStates[voxels[i]] = (inMesh[i] && inStencil[i]) ? INSIDE : OUTSIDE;
+    }
+
+    for (uint32_t voxel = 0; voxel < mStates.size(); ++voxel)
+    {
+        if (mStates[voxel] != OUTSIDE)
+        {
+            mOccupied.push_back(voxel);
+        }
+    }
+}
+
+/**
+    Marks voxels which can be touched by facets as boundary. Voxel is marked if it overlaps facet bounds and the slab
+    between facet vertices along facet normal, this is conservative for non planar facets too.
+*/
+void OccupancyGrid::markFacets(const Mesh* mesh)
+{
+    const Vertex* vertices = mesh->getVertices();
+    const Edge* edges      = mesh->getEdges();
+    const float margin     = mVoxelSize * 1e-3f;
+    const float half       = 0.5f * mVoxelSize;
+    for (uint32_t f = 0; f < mesh->getFacetCount(); ++f)
+    {
+        const Facet* facet = mesh->getFacet(f);
+        if (facet->edgesCount == 0)
+        {
+            continue;
+        }
+
+        // Newell normal and facet bounds
+        NvcVec3 normal = { 0.0f, 0.0f, 0.0f };
+        NvcVec3 fmin   = vertices[edges[facet->firstEdgeNumber].s].p;
+        NvcVec3 fmax   = fmin;
+        for (uint32_t k = 0; k < facet->edgesCount; ++k)
+        {
+            const NvcVec3& a = vertices[edges[facet->firstEdgeNumber + k].s].p;
+            const NvcVec3& b = vertices[edges[facet->firstEdgeNumber + k].e].p;
+            normal.x += (a.y - b.y) * (a.z + b.z);
+            normal.y += (a.z - b.z) * (a.x + b.x);
+            normal.z += (a.x - b.x) * (a.y + b.y);
+            fmin = { std::min(fmin.x, a.x), std::min(fmin.y, a.y), std::min(fmin.z, a.z) };
+            fmax = { std::max(fmax.x, a.x), std::max(fmax.y, a.y), std::max(fmax.z, a.z) };
+        }
+        const float length = sqrtf(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+        float dmin = 0.0f, dmax = 0.0f;
+        const bool hasPlane = length > 0.0f;
+        if (hasPlane)
+        {
+            normal = { normal.x / length, normal.y / length, normal.z / length };
+            dmin   = FLT_MAX;
+            dmax   = -FLT_MAX;
+            for (uint32_t k = 0; k < facet->edgesCount; ++k)
+            {
+                const NvcVec3& a = vertices[edges[facet->firstEdgeNumber + k].s].p;
+                const float d    = normal.x * a.x + normal.y * a.y + normal.z * a.z;
+                dmin             = std::min(dmin, d);
+                dmax             = std::max(dmax, d);
+            }
+        }
+        const float radius = half * (std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z));
+
+        uint32_t lo[3], hi[3];
+        const float mn[3] = { fmin.x - mMinimum.x - margin, fmin.y - mMinimum.y - margin, fmin.z - mMinimum.z - margin };
+        const float mx[3] = { fmax.x - mMinimum.x + margin, fmax.y - mMinimum.y + margin, fmax.z - mMinimum.z + margin };
+        bool outside      = false;
+        for (uint32_t axis = 0; axis < 3; ++axis)
+        {
+            if (mx[axis] < 0.0f || mn[axis] > mResolution[axis] * mVoxelSize)
+            {
+                outside = true;
+            }
+            lo[axis] = std::min(static_cast<uint32_t>(std::max(mn[axis] / mVoxelSize, 0.0f)), mResolution[axis] - 1);
+            hi[axis] = std::min(static_cast<uint32_t>(std::max(mx[axis] / mVoxelSize, 0.0f)), mResolution[axis] - 1);
+        }
+        if (outside)
+        {
+            continue;
+        }
+        for (uint32_t z = lo[2]; z <= hi[2]; ++z)
+        {
+            for (uint32_t y = lo[1]; y <= hi[1]; ++y)
+            {
+                for (uint32_t x = lo[0]; x <= hi[0]; ++x)
+                {
+                    if (hasPlane)
+                    {
+                        const float c = normal.x * (mMinimum.x + (x + 0.5f) * mVoxelSize) +
+                                        normal.y * (mMinimum.y + (y + 0.5f) * mVoxelSize) +
+                                        normal.z * (mMinimum.z + (z + 0.5f) * mVoxelSize);
+                        if (c + radius < dmin - margin || c - radius > dmax + margin)
+                        {
+                            continue;
+                        }
+                    }
+                    mStates[(z * mResolution[1] + y) * mResolution[0] + x] = BOUNDARY;
+                }
+            }
+        }
+    }
+}
+
+OccupancyGrid::State OccupancyGrid::getState(const NvcVec3& point) const
+{
+    const float c[3] = { (point.x - mMinimum.x) / mVoxelSize, (point.y - mMinimum.y) / mVoxelSize,
+                         (point.z - mMinimum.z) / mVoxelSize };
+    uint32_t coord[3];
+    for (uint32_t axis = 0; axis < 3; ++axis)
+    {
+        // Points on the grid sides within facet marking margin belong to the side voxels
+        if (!(c[axis] >= -1e-4f) || c[axis] > mResolution[axis] + 1e-4f)
+        {
+            return OUTSIDE;
+        }
+        coord[axis] = std::min(static_cast<uint32_t>(std::max(c[axis], 0.0f)), mResolution[axis] - 1);
+    }
+    return static_cast<State>(mStates[(coord[2] * mResolution[1] + coord[1]) * mResolution[0] + coord[0]]);
+}
+
+OccupancyGrid::State OccupancyGrid::getOccupiedVoxel(uint32_t index, NvcBounds3& bounds) const
+{
+    const uint32_t voxel = mOccupied[index];
+    const uint32_t x     = voxel % mResolution[0];
+    const uint32_t y     = (voxel / mResolution[0]) % mResolution[1];
+    const uint32_t z     = voxel / (mResolution[0] * mResolution[1]);
+    bounds.minimum       = { mMinimum.x + x * mVoxelSize, mMinimum.y + y * mVoxelSize, mMinimum.z + z * mVoxelSize };
+    bounds.maximum       = { bounds.minimum.x + mVoxelSize, bounds.minimum.y + mVoxelSize, bounds.minimum.z + mVoxelSize };
+    return static_cast<State>(mStates[voxel]);
+}
+
+}  // namespace Blast
+}  // namespace Nv
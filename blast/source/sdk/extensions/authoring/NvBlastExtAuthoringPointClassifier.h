@@ -0,0 +1,131 @@
+/*
+ * © 2025 ReV3nus
+ *
+ * This code is primarily intended for **educational and research purposes**.
+ * You are welcome to view, study, and modify it for personal learning or academic projects.
+ *
+ * **Recommended Restrictions:**
+ * - Commercial use or for-profit distribution is not encouraged without explicit permission.
+ * - Do not sell or redistribute for profit.
+ *
+ * While this code is provided “as-is” without any warranty, we appreciate acknowledgment if used in academic or learning projects.
+ *
+ * For commercial use or licensing inquiries, please contact the author.
+ */
+
+#ifndef NVBLASTEXTAUTHORINGPOINTCLASSIFIER_H
+#define NVBLASTEXTAUTHORINGPOINTCLASSIFIER_H
+
+#include "NvBlastExtAuthoringTypes.h"
+#include <vector>
+
+namespace Nv
+{
+namespace Blast
+{
+
+class Mesh;
+
+/**
+    Point in mesh classifier. Gives the same result as BooleanEvaluator::isPointContainedInMesh: facets shadowing
+    the point along -Z are counted with their winding, but only facets from the point's cell of a 2D grid over
+    facet XY bounds are visited. Facet edges are copied at construction, so the mesh can be changed or released afterwards.
+*/
+class PointInMeshClassifier
+{
+public:
+    /**
+        \param[in] mesh     Closed mesh, nullptr gives classifier which reports every point as outside
+    */
+    PointInMeshClassifier(const Mesh* mesh);
+
+    void                release();
+
+    /**
+        Classify single point.
+        \return Non-zero if point is inside the mesh, normally 1 for closed meshes
+    */
+    int32_t             classify(const NvcVec3& point) const;
+
+    /**
+        Classify a batch of points. Points are grouped by grid cell and tested against facets four at a time with SIMD.
+        \param[in]  points  Points to classify
+        \param[in]  count   Number of points
+        \param[out] results For each point non-zero if it is inside the mesh, same as single point classify
+    */
+    void                classify(const NvcVec3* points, uint32_t count, int32_t* results) const;
+
+private:
+    struct EdgeSegment
+    {
+        NvcVec3 s, e;
+    };
+
+    uint32_t            getCellCoord(float value, uint32_t axis) const;
+    int32_t             facetStatus(uint32_t facet, const NvcVec3& point) const;
+    void                classifyGroup(uint32_t cell, const NvcVec3* points, const uint32_t* indices, uint32_t count, int32_t* results) const;
+
+    float                       mMinimum[2];
+    float                       mInvCellSize[2];
+    uint32_t                    mResolution[2];
+    std::vector<uint32_t>       mCellStart;
+    std::vector<uint32_t>       mCellFacets;
+    std::vector<uint32_t>       mFacetEdgeStart;
+    std::vector<EdgeSegment>    mEdges;
+};
+
+/**
+    Voxel occupancy of a mesh, optionally restricted by stencil mesh. Voxels not touched by any facet are classified
+    by their center, so points in INSIDE and OUTSIDE voxels don't need exact tests, only BOUNDARY voxels do.
+*/
+class OccupancyGrid
+{
+public:
+    enum State
+    {
+        OUTSIDE     = 0,
+        INSIDE      = 1,
+        BOUNDARY    = 2
+    };
+
+    /**
+        \param[in] mesh                Mesh, grid covers its bounding box
+        \param[in] meshClassifier      Classifier of mesh
+        \param[in] stencil             Optional stencil mesh, nullptr if not used
+        \param[in] stencilClassifier   Classifier of stencil, used only with stencil
+    */
+    OccupancyGrid(const Mesh* mesh, const PointInMeshClassifier& meshClassifier, const Mesh* stencil,
+                  const PointInMeshClassifier* stencilClassifier);
+
+    /**
+        State of voxel containing point, OUTSIDE for points out of the grid.
+    */
+    State               getState(const NvcVec3& point) const;
+
+    /**
+        Number of INSIDE and BOUNDARY voxels.
+    */
+    uint32_t            getOccupiedCount() const { return static_cast<uint32_t>(mOccupied.size()); }
+
+    /**
+        Get INSIDE or BOUNDARY voxel.
+        \param[in]  index   Voxel index in [0, getOccupiedCount())
+        \param[out] bounds  Voxel bounds
+        \return             Voxel state
+    */
+    State               getOccupiedVoxel(uint32_t index, NvcBounds3& bounds) const;
+
+private:
+    void                markFacets(const Mesh* mesh);
+
+    NvcVec3                     mMinimum;
+    float                       mVoxelSize;
+    uint32_t                    mResolution[3];
+    std::vector<uint8_t>        mStates;
+    std::vector<uint32_t>       mOccupied;
+};
+
+}  // namespace Blast
+}  // namespace Nv
+
+#endif  // ifndef NVBLASTEXTAUTHORINGPOINTCLASSIFIER_H
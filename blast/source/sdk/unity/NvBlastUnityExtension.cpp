@@ -30,6 +30,7 @@
 #include "NvBlastExtAuthoringBondGeneratorImpl.h"
 #include "NvBlastExtAuthoringCollisionBuilderImpl.h"
 #include "NvBlastExtAuthoringCutoutImpl.h"
+#include "NvBlastExtAuthoringPointClassifier.h"
 #include "NvBlastExtAuthoringInternalCommon.h"
 #include "NvBlastNvSharedHelpers.h"
 #include "NvBlastUnityExtension.h"
@@ -174,6 +175,25 @@ Mesh* NvBlastUnityExtMeshCleanerCleanMesh(MeshCleaner* cleaner, Mesh* mesh)
 	return cleaner->cleanMesh(mesh);
 }
 
+/*
+    Point In Mesh Classifier Functions
+*/
+
+PointInMeshClassifier* NvBlastUnityExtPointClassifierCreate(Mesh* mesh)
+{
+    return new PointInMeshClassifier(mesh);
+}
+
+void NvBlastUnityExtPointClassifierRelease(PointInMeshClassifier* classifier)
+{
+    classifier->release();
+}
+
+void NvBlastUnityExtPointClassifierClassify(PointInMeshClassifier* classifier, NvcVec3* points, int count, void* results)
+{
+    classifier->classify(points, (uint32_t)std::max(count, 0), (int32_t*)results);
+}
+
 /*
     VoronoiSitesGenerator Functions
 */
@@ -256,17 +276,10 @@ int32_t NvBlastUnityExtVSGGetNeighbors(VoronoiSitesGenerator* vsg, void* data, i
 {
     NvcVec2* vertArr = (NvcVec2*)data;
 
-    const NvcVec3* sites = nullptr;
-    uint32_t sitesCount = vsg->getVoronoiSites(sites);
-
-    std::vector<NvcVec3> cellPoints(sitesCount);
-    for (uint32_t i = 0; i < sitesCount; ++i)
-    {
-        cellPoints[i] = sites[i];
-    }
-    std::vector<std::vector<std::pair<int32_t, int32_t>>> neighbors;
-
-    const int32_t neighborCount = findCellBasePlanes(cellPoints, neighbors);
+    int32_t neighborCount = 0;
+    const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors =
+        static_cast<VoronoiSitesGeneratorImpl*>(vsg)->getNeighbors(neighborCount);
+    const uint32_t sitesCount = static_cast<uint32_t>(neighbors.size());
 
     if (neighborCount > bufferSize)
     {
@@ -296,6 +309,21 @@ int32_t NvBlastUnityExtVSGGetNeighbors(VoronoiSitesGenerator* vsg, void* data, i
     return neighborCount;
 }
 
+void NvBlastUnityExtVSGSetNeighborSearch(VoronoiSitesGenerator* vsg, int method)
+{
+    vsg->setNeighborSearch((VoronoiNeighborSearch::Enum)method);
+}
+
+int32_t NvBlastUnityExtVSGGetNeighborsCSR(VoronoiSitesGenerator* vsg, const int32_t** offsets, const int32_t** neighbors, uint32_t* sitesCount)
+{
+    VoronoiSitesGeneratorImpl* impl = static_cast<VoronoiSitesGeneratorImpl*>(vsg);
+    const int32_t neighborCount = impl->getNeighborsCSR(*offsets, *neighbors);
+
+    const NvcVec3* sites = nullptr;
+    *sitesCount = impl->getVoronoiSites(sites);
+    return neighborCount;
+}
+
 
 
 
@@ -325,7 +353,19 @@ bool NvBlastUnityExtFractureToolVoronoiFracturing(FractureTool* tool, uint32_t c
     const NvcVec3* sites = nullptr;
     uint32_t sitesCount = vsg->getVoronoiSites(sites);
 
-    return tool->voronoiFracturing(chunkId, sitesCount, sites, false);
+    // Reuse neighbor graph cached by generator, if it was built with the same search method. Sites are in world space,
+    // so the graph is searched with the chunk scale to match cells built in chunk space.
+    FractureToolImpl* toolImpl   = static_cast<FractureToolImpl*>(tool);
+    const int32_t chunkInfoIndex = tool->getChunkInfoIndex(chunkId);
+    if (vsg->getNeighborSearch() != toolImpl->getNeighborSearch() || chunkInfoIndex == -1)
+    {
+        return tool->voronoiFracturing(chunkId, sitesCount, sites, false);
+    }
+    const float chunkScale = tool->getChunkInfo(chunkInfoIndex).getTmToWorld().s;
+    int32_t neighborCount  = 0;
+    const std::vector<std::vector<std::pair<int32_t, int32_t>>>& neighbors =
+        static_cast<VoronoiSitesGeneratorImpl*>(vsg)->getNeighbors(neighborCount, toolImpl->getThreadCount(), chunkScale);
+    return toolImpl->voronoiFracturing(chunkId, sitesCount, sites, neighbors, neighborCount, false);
 }
 
 bool NvBlastUnityExtFractureToolSlicing(FractureTool* tool, int chunkId, SlicingConfiguration conf, bool replaceChunk)
@@ -343,6 +383,11 @@ uint32_t NvBlastUnityExtFractureToolGetChunkCount(FractureTool* tool)
     return tool->getChunkCount();
 }
 
+void NvBlastUnityExtFractureToolCompactChunks(FractureTool* tool)
+{
+    tool->compactChunks();
+}
+
 Mesh* NvBlastUnityExtFractureToolGetChunkMesh(FractureTool* tool, int chunkId, bool inside)
 {
     Triangle* tris = nullptr;
@@ -420,6 +465,11 @@ int32_t NvBlastUnityExtFractureToolGetChunkDepth(FractureTool* tool, int chunkId
     return tool->getChunkDepth(chunkId);
 }
 
+int32_t NvBlastUnityExtFractureToolGetNextChunkIdAtDepth(FractureTool* tool, uint32_t depth, uint32_t* cursor)
+{
+    return tool->getNextChunkIdAtDepth(depth, *cursor);
+}
+
 int32_t NvBlastUnityExtFractureToolIslandDetectionAndRemoving(FractureTool* tool, int chunkId)
 {
     return tool->islandDetectionAndRemoving(chunkId);
@@ -459,3 +509,64 @@ void NvBlastUnityExtFractureToolGetCrackEdges(Nv::Blast::FractureTool* tool, voi
 {
     tool->getCracks(data);
 }
+
+void NvBlastUnityExtFractureToolSetThreadCount(FractureTool* tool, uint32_t threadCount)
+{
+    tool->setThreadCount(threadCount);
+}
+
+void NvBlastUnityExtFractureToolSetNeighborSearch(FractureTool* tool, int method)
+{
+    tool->setNeighborSearch((VoronoiNeighborSearch::Enum)method);
+}
+
+int32_t NvBlastUnityExtFractureToolVoronoiFracturingBatch(FractureTool* tool, const uint32_t* chunkIds, const uint32_t* cellCounts,
+                                                          const NvcVec3* cellPoints, int chunkCount, bool replaceChunk)
+{
+    return tool->voronoiFracturingBatch((uint32_t)std::max(chunkCount, 0), chunkIds, cellCounts, cellPoints, replaceChunk);
+}
+
+int32_t NvBlastUnityExtFractureToolVoronoiFracturingBatchUniform(FractureTool* tool, const uint32_t* chunkIds, int chunkCount,
+                                                                 int sitesPerChunk, bool replaceChunk)
+{
+    /**
+        Sites are generated serially in chunkIds order, so they depend only on the random seed.
+        Negative counts are taken as 0, as chunkCount is.
+    */
+    const uint32_t siteCount = (uint32_t)std::max(sitesPerChunk, 0);
+    std::vector<uint32_t> cellCounts;
+    std::vector<NvcVec3> cellPoints;
+    for (int c = 0; c < chunkCount; ++c)
+    {
+        const int32_t chunkInfoIndex = tool->getChunkInfoIndex(chunkIds[c]);
+        uint32_t sitesCount = 0;
+        if (chunkInfoIndex != -1)
+        {
+            Mesh* chunkMesh = tool->createChunkMesh(chunkInfoIndex);
+            VoronoiSitesGeneratorImpl vsg(chunkMesh, &rnd);
+            vsg.uniformlyGenerateSitesInMesh(siteCount);
+
+            const NvcVec3* sites = nullptr;
+            sitesCount = vsg.getVoronoiSites(sites);
+            cellPoints.insert(cellPoints.end(), sites, sites + sitesCount);
+            chunkMesh->release();
+        }
+        cellCounts.push_back(sitesCount);
+    }
+    return tool->voronoiFracturingBatch((uint32_t)std::max(chunkCount, 0), chunkIds, cellCounts.data(), cellPoints.data(), replaceChunk);
+}
+
+uint32_t NvBlastUnityExtFractureToolSnapshot(FractureTool* tool)
+{
+    return static_cast<FractureToolImpl*>(tool)->snapshot();
+}
+
+bool NvBlastUnityExtFractureToolRestore(FractureTool* tool, uint32_t snapshotId)
+{
+    return static_cast<FractureToolImpl*>(tool)->restore(snapshotId);
+}
+
+void NvBlastUnityExtFractureToolReleaseSnapshot(FractureTool* tool, uint32_t snapshotId)
+{
+    static_cast<FractureToolImpl*>(tool)->releaseSnapshot(snapshotId);
+}